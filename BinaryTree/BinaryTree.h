@@ -36,7 +36,7 @@ private:
     void inOrder(const std::shared_ptr<Node<T>>& node) const {
         if (node != nullptr) {
             inOrder(node->getLeft());
-            node->proccessNode();
+            node->processNode();
             inOrder(node->getRight());
         }
     }
@@ -47,7 +47,7 @@ private:
     /// @param node subárbol con raíz en node
     void preOrder(const std::shared_ptr<Node<T>>& node) const {
         if (node != nullptr) {
-            node->proccessNode();
+            node->processNode();
             preOrder(node->getLeft());
             preOrder(node->getRight());
         }
@@ -61,7 +61,7 @@ private:
         if (node != nullptr) {
             postOrder(node->getLeft());
             postOrder(node->getRight());
-            node->proccessNode();
+            node->processNode();
         }
     }
 
@@ -219,7 +219,7 @@ public:
             std::shared_ptr<Node<T>> current = q.front();
             q.pop();
 
-            current->proccessNode();
+            current->processNode();
 
             if (current->getLeft() != nullptr) {
                 q.push(current->getLeft());
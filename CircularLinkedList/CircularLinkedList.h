@@ -2,20 +2,27 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 template <typename T>
 class CircularLinkedList {
 public:
 
     // Constructor por defecto
-    CircularLinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+    CircularLinkedList() : head_(nullptr), tail_(nullptr), size_(0), cursorIndex_(0), cursorNode_(nullptr) {}
 
     // Constructor de copia
     CircularLinkedList(const CircularLinkedList& other)
-        : head_(nullptr), tail_(nullptr), size_(0) {
+        : head_(nullptr), tail_(nullptr), size_(0), cursorIndex_(0), cursorNode_(nullptr) {
         copy(other);
     }
 
+    // Constructor de movimiento: se lleva los nodos de other sin copiarlos
+    CircularLinkedList(CircularLinkedList&& other) noexcept
+        : head_(nullptr), tail_(nullptr), size_(0), cursorIndex_(0), cursorNode_(nullptr) {
+        steal(other);
+    }
+
     // Operador =
     CircularLinkedList& operator=(const CircularLinkedList& other) {
         if (this != &other) {
@@ -26,6 +33,16 @@ public:
         return *this;
     }
 
+    // Asignación por movimiento
+    CircularLinkedList& operator=(CircularLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+
+        return *this;
+    }
+
     // Destructor
     ~CircularLinkedList() {
         clear();
@@ -57,6 +74,7 @@ public:
         head_ = nullptr;
         tail_ = nullptr;
         size_ = 0;
+        invalidateCursor();
     }
 
     // Insertar al principio
@@ -72,6 +90,11 @@ public:
             tail_->next = head_;
         }
 
+        // Todos los nodos avanzan una posición, también el del cursor
+        if (cursorNode_ != nullptr) {
+            ++cursorIndex_;
+        }
+
         ++size_;
     }
 
@@ -107,10 +130,8 @@ public:
             return;
         }
 
-        Node* current = head_;
-        for (std::size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
-        }
+        // El cursor queda en el nodo previo, que no se mueve
+        Node* current = nodeAt(index - 1);
 
         Node* newNode = new Node(value, current->next);
         current->next = newNode;
@@ -131,6 +152,7 @@ public:
                 head_ = nullptr;
                 tail_ = nullptr;
                 size_ = 0;
+                invalidateCursor();
                 return true;
             }
 
@@ -139,6 +161,7 @@ public:
             tail_->next = head_;
             delete temp;
             --size_;
+            invalidateCursor();
             return true;
         }
 
@@ -163,6 +186,7 @@ public:
 
         delete temp;
         --size_;
+        invalidateCursor();
         return true;
     }
 
@@ -179,9 +203,17 @@ public:
                 head_ = nullptr;
                 tail_ = nullptr;
                 size_ = 0;
+                invalidateCursor();
                 return;
             }
 
+            // Si el cursor estaba en la cabeza desaparece; si no, retrocede una posición
+            if (cursorNode_ == head_) {
+                invalidateCursor();
+            } else if (cursorNode_ != nullptr) {
+                --cursorIndex_;
+            }
+
             Node* temp = head_;
             head_ = head_->next;
             tail_->next = head_;
@@ -190,10 +222,8 @@ public:
             return;
         }
 
-        Node* current = head_;
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
-        }
+        // El cursor queda en el nodo previo, que no se mueve
+        Node* current = nodeAt(index - 1);
 
         Node* temp = current->next;
         current->next = temp->next;
@@ -212,12 +242,85 @@ public:
             throw std::out_of_range("Index out of range");
         }
 
-        Node* current = head_;
-        for (std::size_t i = 0; i < index; ++i) {
-            current = current->next;
+        return nodeAt(index)->data;
+    }
+
+    // Mueve todos los nodos de other al final de esta lista en O(1). other queda vacía.
+    void append(CircularLinkedList&& other) {
+        splice(size_, other);
+    }
+
+    // Mueve todos los nodos de other a la posición index, sin copiarlos.
+    // O(1) al principio y al final; en otra posición hay que llegar al nodo
+    // previo (desde el cursor si se puede). other queda vacía.
+    void splice(std::size_t index, CircularLinkedList& other) {
+        if (&other == this) {
+            throw std::invalid_argument("Cannot splice a list into itself");
+        }
+        if (index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (other.empty()) {
+            return;
         }
 
-        return current->data;
+        if (empty()) {
+            head_ = other.head_;
+            tail_ = other.tail_;
+        } else if (index == 0 || index == size_) {
+            // Al principio o al final el hueco es el mismo: entre tail_ y head_.
+            // Solo cambia si los nodos nuevos pasan a ser la cabeza o la cola.
+            tail_->next = other.head_;
+            other.tail_->next = head_;
+            if (index == 0) {
+                head_ = other.head_;
+                // Todos los nodos avanzan other.size_ posiciones, también el del cursor
+                if (cursorNode_ != nullptr) {
+                    cursorIndex_ += other.size_;
+                }
+            } else {
+                tail_ = other.tail_;
+            }
+        } else {
+            // El cursor queda en prev, que no se mueve
+            Node* prev = nodeAt(index - 1);
+            other.tail_->next = prev->next;
+            prev->next = other.head_;
+        }
+
+        size_ += other.size_;
+        other.release();
+    }
+
+    // Corta la lista en index: esta se queda con [0, index) y devuelve una
+    // lista nueva con [index, size()), sin copiar nodos. Las dos vuelven a
+    // cerrarse en círculo. Cuesta llegar al nodo previo a index.
+    CircularLinkedList splitAt(std::size_t index) {
+        if (index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        CircularLinkedList rest;
+        if (index == size_) {
+            return rest;
+        }
+
+        if (index == 0) {
+            rest.steal(*this);
+            return rest;
+        }
+
+        // El cursor queda en prev, que se queda en esta lista
+        Node* prev = nodeAt(index - 1);
+        rest.head_ = prev->next;
+        rest.tail_ = tail_;
+        rest.size_ = size_ - index;
+        rest.tail_->next = rest.head_;
+
+        prev->next = head_;
+        tail_ = prev;
+        size_ = index;
+        return rest;
     }
 
     // Imprime la lista
@@ -247,6 +350,55 @@ private:
     Node* tail_;
     std::size_t size_;
 
+    // Cursor: último nodo al que se llegó por índice. Si el siguiente índice
+    // pedido es igual o mayor, la búsqueda sigue desde aquí en lugar de desde
+    // head_, así que los bucles con índices crecientes son O(n) en total.
+    mutable std::size_t cursorIndex_;
+    mutable Node* cursorNode_;   // nullptr si no hay cursor válido
+
+    void invalidateCursor() const {
+        cursorNode_ = nullptr;
+        cursorIndex_ = 0;
+    }
+
+    // Nodo en la posición index (< size_), partiendo del cursor si está antes
+    Node* nodeAt(std::size_t index) const {
+        if (index == size_ - 1) {
+            return tail_;
+        }
+
+        Node* current = head_;
+        std::size_t position = 0;
+        if (cursorNode_ != nullptr && cursorIndex_ <= index) {
+            current = cursorNode_;
+            position = cursorIndex_;
+        }
+
+        for (; position < index; ++position) {
+            current = current->next;
+        }
+
+        cursorIndex_ = index;
+        cursorNode_ = current;
+        return current;
+    }
+
+    // Deja la lista vacía sin liberar los nodos, que ahora son de otra lista
+    void release() {
+        head_ = nullptr;
+        tail_ = nullptr;
+        size_ = 0;
+        invalidateCursor();
+    }
+
+    // Se queda con los nodos de other (esta lista tiene que estar vacía)
+    void steal(CircularLinkedList& other) {
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+        other.release();
+    }
+
     void copy(const CircularLinkedList& other) {
         head_ = nullptr;
         tail_ = nullptr;
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <utility>
 #include "CircularLinkedList.h"
 
 int main() {
@@ -34,5 +35,20 @@ int main() {
     assignedList = list;
     assignedList.print();
 
+    // splitAt / append / splice: mueven nodos entre listas sin copiarlos
+    list.pushBack(40);
+    CircularLinkedList<int> rest = list.splitAt(2);
+    list.print(); // Head -> 10 -> 99 -> (back to Head)
+    rest.print(); // Head -> 30 -> 40 -> (back to Head)
+    CircularLinkedList<int> extra;
+    extra.pushBack(1);
+    extra.pushBack(2);
+    rest.splice(0, extra);    // extra queda vacía
+    rest.print(); // Head -> 1 -> 2 -> 30 -> 40 -> (back to Head)
+    list.append(std::move(rest));
+    list.pushBack(50);        // tail_ apunta al último nodo movido y cierra el círculo
+    list.print(); // Head -> 10 -> 99 -> 1 -> 2 -> 30 -> 40 -> 50 -> (back to Head)
+    std::cout << "Tamaños: " << list.size() << ", " << rest.size() << ", " << extra.size() << "\n"; // 7, 0, 0
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+    Contador de memoria dinámica para los benchmarks.
+
+    Sustituye el operador new y el operador delete globales del programa: cada
+    bloque lleva delante una cabecera con su tamaño, así que al liberarlo se
+    sabe cuánto restar. new[] y delete[] pasan por estos mismos operadores.
+
+        allocationCount: reservas hechas desde que empezó el programa
+        liveBytes:       bytes pedidos y todavía sin liberar
+
+    Los contadores son atómicos para poder contar también en los benchmarks
+    con varios hilos; se leen como un std::size_t normal.
+
+    Los operadores sustitutos no pueden ser inline: este fichero se incluye
+    solo desde el .cpp del benchmark, que es el único de su ejecutable.
+*/
+
+inline std::atomic<std::size_t> allocationCount{0};
+inline std::atomic<std::size_t> liveBytes{0};
+
+// Tamaño de la cabecera: mantiene la alineación que garantiza malloc
+inline constexpr std::size_t kAllocationHeader = alignof(std::max_align_t);
+
+void* operator new(std::size_t size) {
+    void* block = std::malloc(size + kAllocationHeader);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    liveBytes.fetch_add(size, std::memory_order_relaxed);
+    return static_cast<char*>(block) + kAllocationHeader;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(pointer) - kAllocationHeader;
+    liveBytes.fetch_sub(*static_cast<std::size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
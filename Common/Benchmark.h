@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*
+    Utilidades mínimas compartidas por los ejecutables *Benchmark de cada TAD.
+    No se usa ninguna librería externa: basta con un cronómetro, una forma de
+    evitar que el compilador elimine el trabajo medido y un par de funciones
+    para leer argumentos e imprimir resultados.
+*/
+
+// Cronómetro monotónico
+class Stopwatch {
+public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+    void reset() {
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    double elapsedSeconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+    double elapsedNanoseconds() const {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Impide que el optimizador descarte un valor calculado en el bucle medido
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Lee el argumento argv[index] como entero; si no existe devuelve defaultValue
+inline std::size_t argOrDefault(int argc, char** argv, int index, std::size_t defaultValue) {
+    if (index < argc) {
+        return static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10));
+    }
+    return defaultValue;
+}
+
+// Devuelve 10^exponent
+inline std::size_t powerOfTen(std::size_t exponent) {
+    std::size_t result = 1;
+    for (std::size_t i = 0; i < exponent; ++i) {
+        result *= 10;
+    }
+    return result;
+}
+
+// Comprobación de los benchmarks: si falla, avisa y termina el programa
+inline void check(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "ERROR: " << message << "\n";
+        std::exit(1);
+    }
+}
+
+// Generador xorshift64: rápido, reproducible con la misma semilla y sin <random>
+class Random {
+public:
+    explicit Random(std::uint64_t seed) : state_(seed | 1) {}
+
+    std::uint64_t nextRaw() {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 7;
+        state_ ^= state_ << 17;
+        return state_;
+    }
+
+    // Entero en [0, bound)
+    std::size_t next(std::size_t bound) {
+        return static_cast<std::size_t>(nextRaw() % bound);
+    }
+
+    // Uniforme en [0, 1)
+    double nextDouble() {
+        return static_cast<double>(nextRaw() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+// Percentil p (0..100) de un array de muestras. Reordena el array.
+inline double percentile(double* samples, std::size_t count, double p) {
+    if (count == 0) {
+        return 0.0;
+    }
+    std::size_t rank = static_cast<std::size_t>(p / 100.0 * static_cast<double>(count - 1));
+    std::nth_element(samples, samples + rank, samples + count);
+    return samples[rank];
+}
+
+// Imprime una fila de resultados con columnas alineadas
+inline void printResult(const std::string& name, std::size_t n, double nsPerOp) {
+    std::cout << std::left << std::setw(28) << name
+              << std::right << std::setw(12) << n
+              << std::setw(14) << std::fixed << std::setprecision(2) << nsPerOp << " ns/op\n";
+}
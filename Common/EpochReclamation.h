@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+/*
+    Reclamación de memoria basada en épocas (Epoch-Based Reclamation, EBR).
+
+    Las estructuras sin bloqueos no pueden hacer delete de un nodo en cuanto lo
+    desenlazan: otro hilo puede haber leído el puntero justo antes y seguir
+    usándolo. Con EBR:
+
+      1. Todo acceso a la estructura se hace dentro de un EpochGuard, que
+         publica la época global que el hilo ha observado.
+      2. Un nodo desenlazado no se borra: se "retira" anotando la época actual.
+      3. La época global solo avanza cuando todos los hilos activos han
+         observado la época actual. Un nodo retirado en la época e se puede
+         liberar cuando la época global llega a e + 2: ningún hilo que pudiera
+         tener su puntero sigue dentro de una sección protegida.
+
+    Como un nodo no se libera (ni se reutiliza su dirección) mientras algún hilo
+    pueda tener un puntero a él, EBR elimina también el problema ABA en los CAS.
+*/
+
+class EpochDomain {
+public:
+    static constexpr std::size_t kMaxThreads = 256;
+
+    // Dominio global compartido por todas las estructuras concurrentes
+    static EpochDomain& instance() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    // Libera lo que dejaron pendiente los hilos que ya terminaron
+    ~EpochDomain() {
+        for (Retired& retired : orphans_) {
+            retired.deleter(retired.pointer);
+        }
+    }
+
+    // Retira un nodo ya desenlazado. Se liberará con deleter(pointer) cuando sea seguro.
+    void retire(void* pointer, void (*deleter)(void*)) {
+        ThreadRecord& record = localRecord();
+        record.limbo.push_back(Retired{pointer, deleter, globalEpoch_.load(std::memory_order_acquire)});
+
+        if (record.limbo.size() >= record.nextCollect) {
+            collect(record);
+            // Si un hilo lento bloquea la época, no volvemos a recorrer la lista
+            // en cada retire: esperamos a que crezca otro lote
+            record.nextCollect = record.limbo.size() + kCollectThreshold;
+        }
+    }
+
+    template <typename Node>
+    void retire(Node* node) {
+        retire(node, [](void* pointer) { delete static_cast<Node*>(pointer); });
+    }
+
+private:
+    friend class EpochGuard;
+
+    static constexpr std::size_t kCollectThreshold = 64;
+    static constexpr std::uint64_t kInactive = 0;
+
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    // Cada hilo publica su estado en una ranura propia (en su propia línea de caché).
+    // state == kInactive si está fuera de una sección protegida, o (época << 1) | 1.
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> state{kInactive};
+        std::atomic<bool> used{false};
+    };
+
+    // Estado local de cada hilo. Al terminar el hilo se intenta liberar lo pendiente
+    // y lo que todavía no sea seguro pasa a la lista de huérfanos del dominio.
+    struct ThreadRecord {
+        EpochDomain& domain;
+        Slot* slot;
+        std::size_t nesting;
+        std::size_t nextCollect;
+        std::vector<Retired> limbo;
+
+        explicit ThreadRecord(EpochDomain& owner)
+            : domain(owner), slot(owner.acquireSlot()), nesting(0), nextCollect(kCollectThreshold) {}
+
+        ~ThreadRecord() {
+            domain.collect(*this);
+            if (!limbo.empty()) {
+                std::lock_guard<std::mutex> lock(domain.orphansMutex_);
+                domain.orphans_.insert(domain.orphans_.end(), limbo.begin(), limbo.end());
+            }
+            slot->state.store(kInactive, std::memory_order_release);
+            slot->used.store(false, std::memory_order_release);
+        }
+    };
+
+    Slot slots_[kMaxThreads];
+    alignas(64) std::atomic<std::uint64_t> globalEpoch_;
+    std::atomic<std::size_t> slotsInUse_;   // Límite superior de ranuras que hay que revisar
+    std::mutex orphansMutex_;
+    std::vector<Retired> orphans_;
+
+    EpochDomain() : globalEpoch_(1), slotsInUse_(0) {}
+
+    ThreadRecord& localRecord() {
+        thread_local ThreadRecord record(*this);
+        return record;
+    }
+
+    Slot* acquireSlot() {
+        for (std::size_t i = 0; i < kMaxThreads; ++i) {
+            bool expected = false;
+            if (!slots_[i].used.load(std::memory_order_relaxed) &&
+                slots_[i].used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                std::size_t inUse = slotsInUse_.load(std::memory_order_relaxed);
+                while (inUse < i + 1 &&
+                       !slotsInUse_.compare_exchange_weak(inUse, i + 1, std::memory_order_acq_rel)) {
+                }
+                return &slots_[i];
+            }
+        }
+        throw std::runtime_error("EpochDomain: too many threads");
+    }
+
+    void enter(ThreadRecord& record) {
+        if (record.nesting++ == 0) {
+            std::uint64_t epoch = globalEpoch_.load(std::memory_order_relaxed);
+            record.slot->state.store((epoch << 1) | 1, std::memory_order_relaxed);
+            // La publicación debe ser visible antes de leer cualquier puntero compartido
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void exit(ThreadRecord& record) {
+        if (--record.nesting == 0) {
+            record.slot->state.store(kInactive, std::memory_order_release);
+        }
+    }
+
+    // Avanza la época global si todos los hilos activos han observado la actual
+    bool tryAdvance() {
+        std::uint64_t epoch = globalEpoch_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::size_t inUse = slotsInUse_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < inUse; ++i) {
+            std::uint64_t state = slots_[i].state.load(std::memory_order_acquire);
+            if ((state & 1) != 0 && (state >> 1) != epoch) {
+                return false;
+            }
+        }
+        return globalEpoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+    }
+
+    // Libera los nodos de la lista del hilo retirados hace al menos dos épocas
+    void collect(ThreadRecord& record) {
+        tryAdvance();
+        std::uint64_t epoch = globalEpoch_.load(std::memory_order_acquire);
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < record.limbo.size(); ++i) {
+            Retired& retired = record.limbo[i];
+            if (retired.epoch + 2 <= epoch) {
+                retired.deleter(retired.pointer);
+            } else {
+                record.limbo[kept++] = retired;
+            }
+        }
+        record.limbo.resize(kept);
+
+        collectOrphans(epoch);
+    }
+
+    void collectOrphans(std::uint64_t epoch) {
+        std::unique_lock<std::mutex> lock(orphansMutex_, std::try_to_lock);
+        if (!lock.owns_lock() || orphans_.empty()) {
+            return;
+        }
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < orphans_.size(); ++i) {
+            if (orphans_[i].epoch + 2 <= epoch) {
+                orphans_[i].deleter(orphans_[i].pointer);
+            } else {
+                orphans_[kept++] = orphans_[i];
+            }
+        }
+        orphans_.resize(kept);
+    }
+};
+
+// Sección protegida (RAII). Mientras exista, los nodos que el hilo lea de una
+// estructura concurrente no se liberarán. Se puede anidar.
+class EpochGuard {
+public:
+    EpochGuard() : domain_(EpochDomain::instance()), record_(domain_.localRecord()) {
+        domain_.enter(record_);
+    }
+
+    ~EpochGuard() {
+        domain_.exit(record_);
+    }
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+
+private:
+    EpochDomain& domain_;
+    EpochDomain::ThreadRecord& record_;
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+
+/*
+    Comprobación compartida por los benchmarks de las listas doblemente
+    enlazadas (DoublyLinkedList, RawDoublyLinkedList, CompactDoublyLinkedList).
+
+    verifyDoublyLinkedList aplica operaciones al azar a la lista y a un
+    std::vector<int> de referencia y comprueba que los dos tienen siempre el
+    mismo contenido. Sirve para cualquier List<int> con la interfaz de
+    DoublyLinkedList: pushFront, pushBack, insert, remove, removeAt, at,
+    iteradores bidireccionales, insert(it), erase(it) y move_to_front(it).
+*/
+
+// at() recorre desde el extremo más cercano: la segunda mitad usa los prev,
+// igual que los iteradores inversos
+template <typename List>
+void checkSame(List& list, const std::vector<int>& expected) {
+    check(list.getSize() == expected.size(), "getSize() mismatch");
+    check(list.empty() == expected.empty(), "empty() mismatch");
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        check(list.at(i) == expected[i], "at() mismatch");
+    }
+    check(std::equal(list.begin(), list.end(), expected.begin(), expected.end()), "iteration mismatch");
+    check(std::equal(list.rbegin(), list.rend(), expected.rbegin(), expected.rend()), "reverse iteration mismatch");
+}
+
+// extra(list) se llama en uno de cada diez pasos, para operaciones propias de
+// una de las listas que no cambian su contenido (por ejemplo compact())
+template <typename List, typename Extra>
+void verifyDoublyLinkedList(std::size_t steps, Extra extra) {
+    List list;
+    std::vector<int> expected;
+    Random random(steps);
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        int value = static_cast<int>(random.next(50));
+        std::size_t position = random.next(expected.size() + 1);
+        typename List::iterator it = std::next(list.begin(), static_cast<std::ptrdiff_t>(position));
+        switch (random.next(10)) {
+            case 0:
+                list.pushFront(value);
+                expected.insert(expected.begin(), value);
+                break;
+            case 1:
+                list.pushBack(value);
+                expected.push_back(value);
+                break;
+            case 2: {
+                std::size_t index = random.next(expected.size() + 1);
+                list.insert(index, value);
+                expected.insert(expected.begin() + index, value);
+                break;
+            }
+            case 3: {
+                std::vector<int>::iterator found = std::find(expected.begin(), expected.end(), value);
+                check(list.remove(value) == (found != expected.end()), "remove return value is wrong");
+                if (found != expected.end()) {
+                    expected.erase(found);
+                }
+                break;
+            }
+            case 4:
+                if (!expected.empty()) {
+                    std::size_t index = random.next(expected.size());
+                    list.removeAt(index);
+                    expected.erase(expected.begin() + index);
+                }
+                break;
+            case 5:
+                check(*list.insert(it, value) == value, "insert(it) does not return the new element");
+                expected.insert(expected.begin() + position, value);
+                break;
+            case 6:
+                if (position < expected.size()) {
+                    typename List::iterator following = list.erase(it);
+                    expected.erase(expected.begin() + position);
+                    check(following == std::next(list.begin(), static_cast<std::ptrdiff_t>(position)),
+                          "erase(it) does not return the next element");
+                }
+                break;
+            case 7:
+                if (position < expected.size()) {
+                    int moved = *it;
+                    list.move_to_front(it);
+                    check(*it == moved && it == list.begin(), "move_to_front(it) invalidates the iterator");
+                    expected.erase(expected.begin() + position);
+                    expected.insert(expected.begin(), moved);
+                }
+                break;
+            case 8:
+                extra(list);
+                break;
+            default:
+                if (expected.size() > 100) {
+                    list.clear();
+                    expected.clear();
+                }
+                break;
+        }
+
+        if (step % 37 == 0) {
+            checkSame(list, expected);
+        }
+    }
+    checkSame(list, expected);
+
+    // Insertar un elemento de la propia lista
+    if (!expected.empty()) {
+        list.pushBack(list.at(0));
+        expected.push_back(expected.front());
+        list.insert(0, list.at(expected.size() - 1));
+        expected.insert(expected.begin(), expected.back());
+        checkSame(list, expected);
+    }
+
+    List copyList(list);
+    checkSame(copyList, expected);
+    List moved(std::move(copyList));
+    checkSame(moved, expected);
+    check(copyList.empty(), "move does not empty the source list");
+    List assigned;
+    assigned.pushBack(-1);
+    assigned = moved;
+    checkSame(assigned, expected);
+    List moveAssigned;
+    moveAssigned.pushBack(-1);
+    moveAssigned = std::move(assigned);
+    checkSame(moveAssigned, expected);
+}
+
+template <typename List>
+void verifyDoublyLinkedList(std::size_t steps) {
+    verifyDoublyLinkedList<List>(steps, [](List&) {});
+}
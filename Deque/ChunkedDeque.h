@@ -0,0 +1,668 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+    Cola doble (deque) con almacenamiento por bloques.
+
+    Los elementos se guardan en bloques de BlockSize posiciones consecutivas,
+    como en ChunkedStack, y un mapa (un array de punteros a bloque) los pone
+    en orden. El primer elemento está en la posición offset_ del primer
+    bloque usado del mapa, así que el elemento i está en
+
+        bloque (offset_ + i) / BlockSize,  posición (offset_ + i) % BlockSize
+
+    y at(i) es O(1): dos divisiones por una constante y dos accesos a memoria,
+    sin recorrer nada.
+
+    Los bloques usados ocupan un tramo del centro del mapa, con huecos libres
+    a los dos lados. pushFront y pushBack abren un bloque nuevo en el hueco
+    correspondiente cuando el del extremo se llena; solo cuando el hueco se
+    agota se recoloca el tramo o se dobla el mapa, que solo guarda punteros.
+    Los elementos nunca se mueven al crecer, así que las referencias siguen
+    siendo válidas tras pushFront y pushBack (los iteradores no, porque
+    apuntan al mapa).
+
+    Los métodos se llaman igual que los de DoublyLinkedList para que una se
+    pueda cambiar por la otra.
+*/
+
+template <typename T, std::size_t BlockSize = (sizeof(T) < 4096 ? 4096 / sizeof(T) : 1)>
+class ChunkedDeque {
+    static_assert(BlockSize > 0, "BlockSize must be greater than zero");
+
+    struct Block;
+
+public:
+    // Iterador de acceso aleatorio. IsConst distingue iterator de const_iterator.
+    // Guarda la entrada del mapa y la posición dentro del bloque; cualquier
+    // operación que cambie el tamaño del deque lo invalida.
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator() : node_(nullptr), slot_(0) {}
+
+        // Un iterator se puede convertir en const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node_(other.node_), slot_(other.slot_) {}
+
+        reference operator*() const {
+            return *(*node_)->slot(slot_);
+        }
+
+        pointer operator->() const {
+            return (*node_)->slot(slot_);
+        }
+
+        reference operator[](difference_type n) const {
+            return *(*this + n);
+        }
+
+        BasicIterator& operator++() {
+            if (++slot_ == BlockSize) {
+                ++node_;
+                slot_ = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        BasicIterator& operator--() {
+            if (slot_ == 0) {
+                --node_;
+                slot_ = BlockSize;
+            }
+            --slot_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        BasicIterator& operator+=(difference_type n) {
+            difference_type position = static_cast<difference_type>(slot_) + n;
+            difference_type block = static_cast<difference_type>(BlockSize);
+            // División hacia abajo también con position negativo
+            difference_type blocks = position >= 0 ? position / block : -((-position - 1) / block) - 1;
+            node_ += blocks;
+            slot_ = static_cast<std::size_t>(position - blocks * block);
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type n) {
+            return *this += -n;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type n) {
+            return it += n;
+        }
+
+        friend BasicIterator operator+(difference_type n, BasicIterator it) {
+            return it += n;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type n) {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const BasicIterator& a, const BasicIterator& b) {
+            return (a.node_ - b.node_) * static_cast<difference_type>(BlockSize)
+                   + static_cast<difference_type>(a.slot_) - static_cast<difference_type>(b.slot_);
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.node_ == b.node_ && a.slot_ == b.slot_;
+        }
+
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return !(a == b);
+        }
+
+        friend bool operator<(const BasicIterator& a, const BasicIterator& b) {
+            return a.node_ < b.node_ || (a.node_ == b.node_ && a.slot_ < b.slot_);
+        }
+
+        friend bool operator>(const BasicIterator& a, const BasicIterator& b) {
+            return b < a;
+        }
+
+        friend bool operator<=(const BasicIterator& a, const BasicIterator& b) {
+            return !(b < a);
+        }
+
+        friend bool operator>=(const BasicIterator& a, const BasicIterator& b) {
+            return !(a < b);
+        }
+
+    private:
+        friend class ChunkedDeque;
+        template <bool>
+        friend class BasicIterator;
+
+        Block* const* node_;   // Entrada del mapa con el bloque del elemento
+        std::size_t slot_;     // Posición dentro del bloque
+
+        BasicIterator(Block* const* node, std::size_t slot) : node_(node), slot_(slot) {}
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Constructor por defecto: no reserva nada hasta el primer elemento
+    ChunkedDeque()
+        : map_(nullptr), mapCapacity_(0), firstBlock_(0), blockCount_(0), offset_(0), size_(0), spare_(nullptr) {}
+
+    // Constructor de copia
+    ChunkedDeque(const ChunkedDeque& other)
+        : map_(nullptr), mapCapacity_(0), firstBlock_(0), blockCount_(0), offset_(0), size_(0), spare_(nullptr) {
+        copy(other);
+    }
+
+    // Constructor de movimiento: se lleva el mapa y los bloques de other
+    ChunkedDeque(ChunkedDeque&& other) noexcept
+        : map_(nullptr), mapCapacity_(0), firstBlock_(0), blockCount_(0), offset_(0), size_(0), spare_(nullptr) {
+        steal(other);
+    }
+
+    // Asignación = (Deep copy)
+    ChunkedDeque& operator=(const ChunkedDeque& other) {
+        if (this != &other) {
+            clear();
+            copy(other);
+        }
+
+        return *this;
+    }
+
+    // Asignación por movimiento
+    ChunkedDeque& operator=(ChunkedDeque&& other) noexcept {
+        if (this != &other) {
+            freeDeque();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    // Destructor
+    ~ChunkedDeque() {
+        freeDeque();
+    }
+
+    // Comprueba si el deque está vacío
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Devuelve el número de elementos
+    std::size_t getSize() const {
+        return size_;
+    }
+
+    // Elimina todos los elementos. Se conserva el mapa y un bloque de reserva.
+    void clear() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            element(i)->~T();
+        }
+        size_ = 0;
+        releaseAllBlocks();
+    }
+
+    // Añade un elemento al principio. O(1).
+    void pushFront(const T& value) {
+        if (offset_ == 0) {
+            pushBlockFront();
+            offset_ = BlockSize;
+        }
+
+        new (map_[firstBlock_]->slot(offset_ - 1)) T(value);
+        --offset_;
+        ++size_;
+    }
+
+    // Añade un elemento al final. O(1).
+    void pushBack(const T& value) {
+        std::size_t end = offset_ + size_;
+        if (end == blockCount_ * BlockSize) {
+            pushBlockBack();
+        }
+
+        new (slotAt(end)) T(value);
+        ++size_;
+    }
+
+    // Elimina el primer elemento. O(1).
+    void popFront() {
+        if (empty()) {
+            throw std::underflow_error("deque is empty");
+        }
+
+        slotAt(offset_)->~T();
+        ++offset_;
+        --size_;
+
+        if (size_ == 0) {
+            releaseAllBlocks();
+        }else if (offset_ == BlockSize) {
+            popBlockFront();
+            offset_ = 0;
+        }
+    }
+
+    // Elimina el último elemento. O(1).
+    void popBack() {
+        if (empty()) {
+            throw std::underflow_error("deque is empty");
+        }
+
+        --size_;
+        std::size_t end = offset_ + size_;
+        slotAt(end)->~T();
+
+        // El último bloque se libera cuando ya no queda ningún elemento en él
+        if (size_ == 0) {
+            releaseAllBlocks();
+        }else if (end == (blockCount_ - 1) * BlockSize) {
+            popBlockBack();
+        }
+    }
+
+    // Primer y último elemento
+    T& front() {
+        if (empty()) {
+            throw std::underflow_error("deque is empty");
+        }
+        return *slotAt(offset_);
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::underflow_error("deque is empty");
+        }
+        return *slotAt(offset_ + size_ - 1);
+    }
+
+    // Añade un elemento en un índice especificado. Desplaza los elementos
+    // del lado más corto: O(min(index, getSize() - index)).
+    void insert(const std::size_t index, const T& value) {
+        if (index > size_) {
+            throw std::out_of_range("index out of range");
+        }
+
+        // value podría ser uno de los elementos que se van a desplazar
+        T item(value);
+
+        if (index < size_ / 2) {
+            pushFront(*slotAt(offset_));
+            if (index > 1) {
+                moveTowardsFront(2, 1, index - 1);
+            }
+        }else {
+            pushBack(size_ > 0 ? *slotAt(offset_ + size_ - 1) : item);
+            moveTowardsBack(index, index + 1, size_ - 1 - index);
+        }
+
+        *element(index) = std::move(item);
+    }
+
+    // Elimina la primera aparición de un elemento. O(n).
+    bool remove(const T& value) {
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (*element(i) == value) {
+                removeAt(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Elimina un elemento en un índice especificado. Desplaza los elementos
+    // del lado más corto: O(min(index, getSize() - index)).
+    void removeAt(std::size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("index out of range");
+        }
+
+        if (index < size_ / 2) {
+            moveTowardsBack(0, 1, index);
+            popFront();
+        }else {
+            moveTowardsFront(index + 1, index, size_ - 1 - index);
+            popBack();
+        }
+    }
+
+    // Devuelve un elemento en una posición especificada. O(1).
+    T& at(const std::size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("index out of range");
+        }
+
+        return *element(index);
+    }
+
+    const T& at(const std::size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("index out of range");
+        }
+
+        return *element(index);
+    }
+
+    iterator begin() {
+        return iteratorAt(0);
+    }
+
+    iterator end() {
+        return iteratorAt(size_);
+    }
+
+    const_iterator begin() const {
+        return const_cast<ChunkedDeque*>(this)->iteratorAt(0);
+    }
+
+    const_iterator end() const {
+        return const_cast<ChunkedDeque*>(this)->iteratorAt(size_);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const {
+        return rbegin();
+    }
+
+    const_reverse_iterator crend() const {
+        return rend();
+    }
+
+    // Inserta value justo antes de position. Devuelve un iterador al nuevo elemento.
+    iterator insert(const_iterator position, const T& value) {
+        std::size_t index = static_cast<std::size_t>(position - cbegin());
+        insert(index, value);
+        return iteratorAt(index);
+    }
+
+    // Elimina el elemento de position. Devuelve un iterador al siguiente.
+    iterator erase(const_iterator position) {
+        std::size_t index = static_cast<std::size_t>(position - cbegin());
+        if (index >= size_) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        removeAt(index);
+        return iteratorAt(index);
+    }
+
+    void printForward() const {
+        if (empty()) {
+            std::cout << "[Empty deque]\n";
+            return;
+        }
+
+        std::cout << "Front -> ";
+        for (std::size_t i = 0; i < size_; ++i) {
+            std::cout << *element(i);
+            if (i + 1 < size_) {
+                std::cout << " | ";
+            }
+        }
+        std::cout << " <- Back\n";
+    }
+
+    void printBackward() const {
+        if (empty()) {
+            std::cout << "[Empty deque]\n";
+            return;
+        }
+
+        std::cout << "Back -> ";
+        for (std::size_t i = size_; i > 0; --i) {
+            std::cout << *element(i - 1);
+            if (i > 1) {
+                std::cout << " | ";
+            }
+        }
+        std::cout << " <- Front\n";
+    }
+
+private:
+    // Bloque de BlockSize elementos. La memoria se reserva sin construir los T,
+    // que se construyen con placement new al insertar y se destruyen al sacar.
+    struct Block {
+        alignas(T) unsigned char storage[sizeof(T) * BlockSize];
+
+        T* slot(std::size_t index) {
+            return std::launder(reinterpret_cast<T*>(storage) + index);
+        }
+    };
+
+    static constexpr std::size_t kInitialMapCapacity = 8;
+
+    Block** map_;
+    std::size_t mapCapacity_;
+    std::size_t firstBlock_;   // Entrada del mapa del primer bloque usado
+    std::size_t blockCount_;   // Bloques usados: map_[firstBlock_, firstBlock_ + blockCount_)
+    std::size_t offset_;       // Posición del primer elemento en el primer bloque
+    std::size_t size_;
+    Block* spare_;             // Último bloque liberado, reservado para reutilizar
+
+    // Posición de la celda 'position' contando desde el principio del primer bloque
+    T* slotAt(std::size_t position) const {
+        return map_[firstBlock_ + position / BlockSize]->slot(position % BlockSize);
+    }
+
+    T* element(std::size_t index) const {
+        return slotAt(offset_ + index);
+    }
+
+    // Mueve count elementos de [from, from + count) a [to, to + count), con
+    // to < from, de delante hacia atrás. Cada paso mueve el tramo más largo
+    // que es contiguo tanto en el bloque de origen como en el de destino.
+    void moveTowardsFront(std::size_t from, std::size_t to, std::size_t count) {
+        while (count > 0) {
+            std::size_t source = offset_ + from;
+            std::size_t target = offset_ + to;
+            std::size_t chunk = std::min(count, std::min(BlockSize - source % BlockSize, BlockSize - target % BlockSize));
+            T* first = slotAt(source);
+            std::move(first, first + chunk, slotAt(target));
+            from += chunk;
+            to += chunk;
+            count -= chunk;
+        }
+    }
+
+    // Igual, con to > from: se mueve de atrás hacia delante para no pisar
+    // elementos que aún no se han movido
+    void moveTowardsBack(std::size_t from, std::size_t to, std::size_t count) {
+        while (count > 0) {
+            std::size_t sourceLast = offset_ + from + count - 1;
+            std::size_t targetLast = offset_ + to + count - 1;
+            std::size_t chunk = std::min(count, std::min(sourceLast % BlockSize + 1, targetLast % BlockSize + 1));
+            T* last = slotAt(sourceLast) + 1;
+            std::move_backward(last - chunk, last, slotAt(targetLast) + 1);
+            count -= chunk;
+        }
+    }
+
+    iterator iteratorAt(std::size_t index) {
+        if (map_ == nullptr) {
+            return iterator();
+        }
+        std::size_t position = offset_ + index;
+        return iterator(map_ + firstBlock_ + position / BlockSize, position % BlockSize);
+    }
+
+    Block* acquireBlock() {
+        if (spare_ != nullptr) {
+            Block* block = spare_;
+            spare_ = nullptr;
+            return block;
+        }
+        return new Block;
+    }
+
+    void releaseBlock(Block* block) {
+        if (spare_ == nullptr) {
+            spare_ = block;
+        } else {
+            delete block;
+        }
+    }
+
+    // Deja al menos una entrada libre del lado pedido del mapa. Si en total
+    // sobra sitio, recoloca los bloques usados en el centro; si no, dobla el mapa.
+    void makeRoom(bool front) {
+        bool hasRoom = front ? firstBlock_ > 0 : firstBlock_ + blockCount_ < mapCapacity_;
+        if (hasRoom) {
+            return;
+        }
+
+        std::size_t capacity = mapCapacity_;
+        if (capacity < 2 * (blockCount_ + 1)) {
+            capacity = capacity == 0 ? kInitialMapCapacity : capacity * 2;
+        }
+
+        Block** map = capacity == mapCapacity_ ? map_ : new Block*[capacity];
+        std::size_t first = (capacity - blockCount_) / 2;
+        if (map == map_) {
+            // Mismo array: el tramo se mueve hacia el centro sin pisarse
+            if (first < firstBlock_) {
+                for (std::size_t i = 0; i < blockCount_; ++i) {
+                    map[first + i] = map_[firstBlock_ + i];
+                }
+            } else {
+                for (std::size_t i = blockCount_; i > 0; --i) {
+                    map[first + i - 1] = map_[firstBlock_ + i - 1];
+                }
+            }
+        } else {
+            for (std::size_t i = 0; i < blockCount_; ++i) {
+                map[first + i] = map_[firstBlock_ + i];
+            }
+            delete[] map_;
+            map_ = map;
+            mapCapacity_ = capacity;
+        }
+        firstBlock_ = first;
+    }
+
+    void pushBlockFront() {
+        makeRoom(true);
+        map_[firstBlock_ - 1] = acquireBlock();
+        --firstBlock_;
+        ++blockCount_;
+    }
+
+    void pushBlockBack() {
+        makeRoom(false);
+        map_[firstBlock_ + blockCount_] = acquireBlock();
+        ++blockCount_;
+    }
+
+    void popBlockFront() {
+        releaseBlock(map_[firstBlock_]);
+        ++firstBlock_;
+        --blockCount_;
+    }
+
+    void popBlockBack() {
+        releaseBlock(map_[firstBlock_ + blockCount_ - 1]);
+        --blockCount_;
+    }
+
+    // Con el deque vacío: suelta los bloques y vuelve al centro del mapa
+    void releaseAllBlocks() {
+        while (blockCount_ > 0) {
+            popBlockBack();
+        }
+        firstBlock_ = mapCapacity_ / 2;
+        offset_ = 0;
+    }
+
+    void freeDeque() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            element(i)->~T();
+        }
+        for (std::size_t i = 0; i < blockCount_; ++i) {
+            delete map_[firstBlock_ + i];
+        }
+        delete spare_;
+        delete[] map_;
+
+        map_ = nullptr;
+        mapCapacity_ = 0;
+        firstBlock_ = 0;
+        blockCount_ = 0;
+        offset_ = 0;
+        size_ = 0;
+        spare_ = nullptr;
+    }
+
+    void copy(const ChunkedDeque& other) {
+        for (std::size_t i = 0; i < other.size_; ++i) {
+            pushBack(*other.element(i));
+        }
+    }
+
+    // Se queda con el mapa y los bloques de other (este deque no tiene que tener ninguno)
+    void steal(ChunkedDeque& other) {
+        map_ = other.map_;
+        mapCapacity_ = other.mapCapacity_;
+        firstBlock_ = other.firstBlock_;
+        blockCount_ = other.blockCount_;
+        offset_ = other.offset_;
+        size_ = other.size_;
+        spare_ = other.spare_;
+        other.map_ = nullptr;
+        other.mapCapacity_ = 0;
+        other.firstBlock_ = 0;
+        other.blockCount_ = 0;
+        other.offset_ = 0;
+        other.size_ = 0;
+        other.spare_ = nullptr;
+    }
+};
@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.h"
+#include "ChunkedDeque.h"
+#include "DoublyLinkedList.h"
+#include "RawDoublyLinkedList.h"
+
+// BENCHMARK: ChunkedDeque frente a DoublyLinkedList, RawDoublyLinkedList y std::deque
+//
+// Uso: ./ChunkedDequeBenchmark [exponente_maximo] [operaciones_lineales]
+// Para n = 10^3 a 10^exponente_maximo (10^5 por defecto) elementos int se
+// imprime una matriz de ns por operación (el mejor de tres intentos), un
+// patrón de acceso por fila:
+//  - pushBack / pushFront: llenar la estructura por un extremo
+//  - recorrido: sumar todos los elementos con iteradores
+//  - at secuencial: at(i) con i creciente; at aleatorio: i al azar
+//  - cola: pushBack + removeAt(0), como una cola FIFO de n elementos
+//  - insert en medio: insert(getSize() / 2, v)
+// En las listas, at e insert en medio son O(n): esas filas solo hacen
+// 'operaciones_lineales' operaciones (1000 por defecto), repartidas por toda
+// la estructura. Las cuatro estructuras se usan con los mismos nombres de
+// método, los de DoublyLinkedList; std::deque va envuelta en un adaptador.
+// Antes se comprueba ChunkedDeque frente a un std::vector con operaciones al
+// azar, con bloques de 4 elementos para pasar a menudo de un bloque a otro.
+
+// std::deque con los nombres de DoublyLinkedList
+class StdDeque {
+public:
+    using const_iterator = std::deque<int>::const_iterator;
+
+    std::size_t getSize() const {
+        return deque_.size();
+    }
+
+    void pushFront(int value) {
+        deque_.push_front(value);
+    }
+
+    void pushBack(int value) {
+        deque_.push_back(value);
+    }
+
+    void insert(std::size_t index, int value) {
+        deque_.insert(deque_.begin() + static_cast<std::ptrdiff_t>(index), value);
+    }
+
+    void removeAt(std::size_t index) {
+        deque_.erase(deque_.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    int& at(std::size_t index) {
+        return deque_.at(index);
+    }
+
+    const_iterator begin() const {
+        return deque_.begin();
+    }
+
+    const_iterator end() const {
+        return deque_.end();
+    }
+
+private:
+    std::deque<int> deque_;
+};
+
+using SmallDeque = ChunkedDeque<int, 4>;
+
+static void checkSame(SmallDeque& deque, const std::vector<int>& expected) {
+    check(deque.getSize() == expected.size(), "getSize() mismatch");
+    check(deque.empty() == expected.empty(), "empty() mismatch");
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        check(deque.at(i) == expected[i], "at() mismatch");
+    }
+    check(std::equal(deque.begin(), deque.end(), expected.begin(), expected.end()), "iteration mismatch");
+    check(std::equal(deque.rbegin(), deque.rend(), expected.rbegin(), expected.rend()), "reverse iteration mismatch");
+    check(deque.end() - deque.begin() == static_cast<std::ptrdiff_t>(expected.size()), "iterator distance mismatch");
+    for (std::size_t i = 0; i < expected.size(); i += 3) {
+        check(deque.begin()[static_cast<std::ptrdiff_t>(i)] == expected[i], "iterator[] mismatch");
+        check(*(deque.end() - static_cast<std::ptrdiff_t>(expected.size() - i)) == expected[i], "iterator - n mismatch");
+    }
+    if (!expected.empty()) {
+        check(deque.front() == expected.front() && deque.back() == expected.back(), "front()/back() mismatch");
+    }
+}
+
+static void verify(std::size_t steps) {
+    SmallDeque deque;
+    std::vector<int> expected;
+    Random random(steps);
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        int value = static_cast<int>(random.next(50));
+        switch (random.next(11)) {
+            case 0:
+            case 1:
+                deque.pushFront(value);
+                expected.insert(expected.begin(), value);
+                break;
+            case 2:
+            case 3:
+                deque.pushBack(value);
+                expected.push_back(value);
+                break;
+            case 4:
+                if (!expected.empty()) {
+                    deque.popFront();
+                    expected.erase(expected.begin());
+                }
+                break;
+            case 5:
+                if (!expected.empty()) {
+                    deque.popBack();
+                    expected.pop_back();
+                }
+                break;
+            case 6: {
+                std::size_t index = random.next(expected.size() + 1);
+                deque.insert(index, value);
+                expected.insert(expected.begin() + index, value);
+                break;
+            }
+            case 7: {
+                std::vector<int>::iterator found = std::find(expected.begin(), expected.end(), value);
+                check(deque.remove(value) == (found != expected.end()), "remove return value is wrong");
+                if (found != expected.end()) {
+                    expected.erase(found);
+                }
+                break;
+            }
+            case 8:
+                if (!expected.empty()) {
+                    std::size_t index = random.next(expected.size());
+                    deque.removeAt(index);
+                    expected.erase(expected.begin() + index);
+                }
+                break;
+            case 9: {
+                std::size_t position = random.next(expected.size() + 1);
+                SmallDeque::iterator it = deque.begin() + static_cast<std::ptrdiff_t>(position);
+                if (position < expected.size() && random.next(2) == 0) {
+                    SmallDeque::iterator following = deque.erase(it);
+                    expected.erase(expected.begin() + position);
+                    check(following - deque.begin() == static_cast<std::ptrdiff_t>(position),
+                          "erase(it) does not return the next element");
+                } else {
+                    check(*deque.insert(it, value) == value, "insert(it) does not return the new element");
+                    expected.insert(expected.begin() + position, value);
+                }
+                break;
+            }
+            default:
+                if (expected.size() > 200 || random.next(20) == 0) {
+                    deque.clear();
+                    expected.clear();
+                }
+                break;
+        }
+
+        if (step % 37 == 0) {
+            checkSame(deque, expected);
+        }
+    }
+    checkSame(deque, expected);
+
+    // Insertar un elemento del propio deque
+    if (!expected.empty()) {
+        deque.insert(0, deque.at(expected.size() - 1));
+        expected.insert(expected.begin(), expected.back());
+        checkSame(deque, expected);
+    }
+
+    SmallDeque copyDeque(deque);
+    checkSame(copyDeque, expected);
+    SmallDeque moved(std::move(copyDeque));
+    checkSame(moved, expected);
+    check(copyDeque.empty(), "move does not empty the source deque");
+    SmallDeque assigned;
+    assigned.pushBack(-1);
+    assigned = moved;
+    checkSame(assigned, expected);
+    SmallDeque moveAssigned;
+    moveAssigned.pushFront(-1);
+    moveAssigned = std::move(assigned);
+    checkSame(moveAssigned, expected);
+
+    // Las referencias sobreviven a pushFront y pushBack
+    ChunkedDeque<int> stable;
+    stable.pushBack(7);
+    int& reference = stable.at(0);
+    for (int i = 0; i < 100000; ++i) {
+        stable.pushFront(i);
+        stable.pushBack(i);
+    }
+    check(&reference == &stable.at(100000) && reference == 7, "pushFront/pushBack move the elements");
+}
+
+template <typename D>
+static void fill(D& deque, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        deque.pushBack(static_cast<int>(i));
+    }
+}
+
+// ns por operación de cada patrón de acceso
+template <typename D>
+static double timePattern(std::size_t pattern, std::size_t n, std::size_t linear, bool isList) {
+    D deque;
+    Random random(n);
+    std::size_t operations = n;
+    long long sum = 0;
+    Stopwatch watch;
+
+    switch (pattern) {
+        case 0:
+            watch.reset();
+            fill(deque, n);
+            break;
+        case 1:
+            watch.reset();
+            for (std::size_t i = 0; i < n; ++i) {
+                deque.pushFront(static_cast<int>(i));
+            }
+            break;
+        case 2:
+            fill(deque, n);
+            watch.reset();
+            for (typename D::const_iterator it = deque.begin(); it != deque.end(); ++it) {
+                sum += *it;
+            }
+            break;
+        case 3: {
+            fill(deque, n);
+            operations = isList ? std::min(n, linear) : n;
+            std::size_t stride = n / operations;
+            watch.reset();
+            for (std::size_t i = 0; i < operations; ++i) {
+                sum += deque.at(i * stride);
+            }
+            break;
+        }
+        case 4: {
+            fill(deque, n);
+            operations = isList ? std::min(n, linear) : n;
+            watch.reset();
+            for (std::size_t i = 0; i < operations; ++i) {
+                sum += deque.at(random.next(n));
+            }
+            break;
+        }
+        case 5:
+            fill(deque, n);
+            watch.reset();
+            for (std::size_t i = 0; i < n; ++i) {
+                deque.pushBack(static_cast<int>(i));
+                deque.removeAt(0);
+            }
+            break;
+        default:
+            fill(deque, n);
+            operations = std::min(n, linear);
+            watch.reset();
+            for (std::size_t i = 0; i < operations; ++i) {
+                deque.insert(deque.getSize() / 2, static_cast<int>(i));
+            }
+            break;
+    }
+
+    double nsPerOp = watch.elapsedNanoseconds() / static_cast<double>(operations);
+    doNotOptimize(sum);
+    return nsPerOp;
+}
+
+// Mejor de tres: la primera vez que se toca la memoria pedida al sistema
+// cuesta un fallo de página, y si no lo pagaría la estructura que se mida antes
+template <typename D>
+static double bestOf(std::size_t pattern, std::size_t n, std::size_t linear, bool isList) {
+    double best = timePattern<D>(pattern, n, linear, isList);
+    for (int round = 1; round < 3; ++round) {
+        best = std::min(best, timePattern<D>(pattern, n, linear, isList));
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 5);
+    std::size_t linear = argOrDefault(argc, argv, 2, 1000);
+
+    verify(20000);
+    std::cout << "Verificacion frente a std::vector: OK\n";
+
+    const char* patterns[] = {"pushBack", "pushFront", "recorrido", "at secuencial", "at aleatorio",
+                              "cola", "insert en medio"};
+
+    for (std::size_t exp = 3; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        std::cout << "\nn = " << n << "                DoublyLinkedList   RawDoublyLinkedList   ChunkedDeque   std::deque   (ns/op)\n";
+        for (std::size_t pattern = 0; pattern < 7; ++pattern) {
+            std::cout << std::left << std::setw(20) << patterns[pattern] << std::right
+                      << std::fixed << std::setprecision(2)
+                      << std::setw(20) << bestOf<DoublyLinkedList<int>>(pattern, n, linear, true)
+                      << std::setw(22) << bestOf<RawDoublyLinkedList<int>>(pattern, n, linear, true)
+                      << std::setw(15) << bestOf<ChunkedDeque<int>>(pattern, n, linear, false)
+                      << std::setw(13) << bestOf<StdDeque>(pattern, n, linear, false) << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <stdexcept>
+#include "ChunkedDeque.h"
+
+int main() {
+
+    // Bloques de 4 elementos para ver cómo se abren y se sueltan
+    ChunkedDeque<int, 4> deque;
+
+    deque.pushBack(10);
+    deque.pushBack(20);
+    deque.pushBack(30);
+    deque.printForward();   // Front -> 10 | 20 | 30 <- Back
+
+    deque.pushFront(5);
+    deque.pushFront(1);     // Abre un bloque nuevo por delante
+    deque.printForward();   // Front -> 1 | 5 | 10 | 20 | 30 <- Back
+
+    // at() en O(1): bloque (offset + i) / 4, posición (offset + i) % 4
+    std::cout << "Element at index 3: " << deque.at(3) << "\n";   // 20
+
+    deque.insert(2, 7);     // Desplaza el lado más corto
+    deque.printForward();   // Front -> 1 | 5 | 7 | 10 | 20 | 30 <- Back
+
+    deque.remove(20);
+    deque.removeAt(0);
+    deque.printForward();   // Front -> 5 | 7 | 10 | 30 <- Back
+
+    deque.popFront();
+    deque.popBack();
+    deque.printBackward();  // Back -> 10 | 7 <- Front
+    std::cout << "front: " << deque.front() << ", back: " << deque.back() << "\n";
+
+    ChunkedDeque<int, 4> copyDeque(deque);
+    copyDeque.pushBack(99);
+    copyDeque.printForward();   // Front -> 7 | 10 | 99 <- Back
+    deque.printForward();       // Front -> 7 | 10 <- Back
+
+    // Iteradores de acceso aleatorio
+    for (int i = 1; i <= 6; ++i) {
+        copyDeque.pushBack(i * 100);
+    }
+    ChunkedDeque<int, 4>::iterator it = copyDeque.begin() + 5;
+    std::cout << "begin() + 5: " << *it << ", end() - begin(): " << (copyDeque.end() - copyDeque.begin()) << "\n";
+    copyDeque.erase(it);
+    std::cout << "Al revés:";
+    for (ChunkedDeque<int, 4>::reverse_iterator r = copyDeque.rbegin(); r != copyDeque.rend(); ++r) {
+        std::cout << " " << *r;
+    }
+    std::cout << "\n";
+
+    try {
+        deque.at(10);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Exception: " << e.what() << "\n";
+    }
+
+    return 0;
+}
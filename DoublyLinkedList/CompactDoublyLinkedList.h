@@ -0,0 +1,573 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+/*
+    Lista doblemente enlazada sobre un único array de nodos (slab).
+
+    Misma idea que DoublyLinkedList, pero los nodos no se piden uno a uno al
+    heap: viven en un array contiguo que se dobla cuando se llena, y prev y
+    next son índices de 32 bits dentro de ese array en vez de punteros. Con
+    T de 8 bytes un nodo ocupa 16, frente a los 24 de RawDoublyLinkedList
+    (más la cabecera de malloc) y los 56 de DoublyLinkedList.
+
+    Las posiciones libres (de elementos borrados) se encadenan por su campo
+    next en una lista de libres y se reutilizan antes de crecer. Como los
+    enlaces son índices, al crecer el array no hay que arreglar ninguno.
+
+    Con inserciones y borrados en medio, el orden de la lista deja de
+    coincidir con el orden en memoria y recorrerla salta por el array.
+    compact() vuelve a colocar los nodos en el orden de la lista, uno detrás
+    de otro, para que el recorrido sea secuencial.
+*/
+
+template <typename T>
+class CompactDoublyLinkedList {
+private:
+    using Index = std::uint32_t;
+
+    static constexpr Index kNone = static_cast<Index>(-1);   // Índice nulo
+    static constexpr std::size_t kInitialCapacity = 16;
+
+    // El valor se construye con placement new solo cuando el nodo está en uso
+    struct Node {
+        alignas(T) unsigned char storage[sizeof(T)];
+        Index next;   // En un nodo libre: siguiente libre
+        Index prev;
+
+        T* value() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        const T* value() const {
+            return std::launder(reinterpret_cast<const T*>(storage));
+        }
+    };
+
+    Node* nodes;
+    std::size_t capacity;   // Nodos reservados
+    std::size_t used;       // Nodos repartidos alguna vez: [0, used)
+    Index freeHead;         // Primer nodo libre, o kNone
+    Index head;
+    Index tail;
+    std::size_t size;
+
+    void copy(const CompactDoublyLinkedList& other) {
+        reserve(other.size);
+        for (Index current = other.head; current != kNone; current = other.nodes[current].next) {
+            pushBack(*other.nodes[current].value());
+        }
+    }
+
+    // Se queda con el array de other (esta lista no tiene que tener ninguno)
+    void steal(CompactDoublyLinkedList& other) {
+        nodes = other.nodes;
+        capacity = other.capacity;
+        used = other.used;
+        freeHead = other.freeHead;
+        head = other.head;
+        tail = other.tail;
+        size = other.size;
+        other.nodes = nullptr;
+        other.capacity = 0;
+        other.used = 0;
+        other.freeHead = kNone;
+        other.head = kNone;
+        other.tail = kNone;
+        other.size = 0;
+    }
+
+    // Pasa los nodos a un array de newCapacity. Si inOrder, además los coloca
+    // en el orden de la lista; si no, cada uno conserva su índice.
+    void relocate(std::size_t newCapacity, bool inOrder) {
+        Node* target = new Node[newCapacity];
+
+        if (inOrder) {
+            Index position = 0;
+            for (Index current = head; current != kNone; current = nodes[current].next, ++position) {
+                new (target[position].storage) T(std::move(*nodes[current].value()));
+                nodes[current].value()->~T();
+                target[position].prev = position == 0 ? kNone : position - 1;
+                target[position].next = position + 1 == size ? kNone : position + 1;
+            }
+            used = size;
+            freeHead = kNone;
+            head = size == 0 ? kNone : 0;
+            tail = size == 0 ? kNone : static_cast<Index>(size - 1);
+        }else {
+            for (std::size_t i = 0; i < used; ++i) {
+                target[i].next = nodes[i].next;
+                target[i].prev = nodes[i].prev;
+            }
+            for (Index current = head; current != kNone; current = nodes[current].next) {
+                new (target[current].storage) T(std::move(*nodes[current].value()));
+                nodes[current].value()->~T();
+            }
+        }
+
+        delete[] nodes;
+        nodes = target;
+        capacity = newCapacity;
+    }
+
+    // Dobla el array de nodos
+    void grow() {
+        if (capacity == kNone) {
+            throw std::length_error("list is full");
+        }
+        std::size_t newCapacity = capacity == 0 ? kInitialCapacity : capacity * 2;
+        relocate(newCapacity < kNone ? newCapacity : kNone, false);
+    }
+
+    // Devuelve un nodo sin enlazar con value ya construido
+    Index acquire(const T& value) {
+        if (freeHead == kNone && used == capacity) {
+            // value puede ser un elemento de esta lista y relocate() libera el
+            // array en el que vive: se copia antes de crecer
+            T item(value);
+            grow();
+            return place(std::move(item));
+        }
+        return place(value);
+    }
+
+    // Construye value en un nodo libre, que tiene que haberlo
+    template <typename U>
+    Index place(U&& value) {
+        Index index;
+        if (freeHead != kNone) {
+            index = freeHead;
+            freeHead = nodes[index].next;
+        }else {
+            index = static_cast<Index>(used++);
+        }
+
+        try {
+            new (nodes[index].storage) T(std::forward<U>(value));
+        } catch (...) {
+            nodes[index].next = freeHead;
+            freeHead = index;
+            throw;
+        }
+        nodes[index].next = kNone;
+        nodes[index].prev = kNone;
+        return index;
+    }
+
+    // Destruye el valor y deja el nodo en la lista de libres
+    void release(Index index) {
+        nodes[index].value()->~T();
+        nodes[index].next = freeHead;
+        freeHead = index;
+    }
+
+    // Nodo en la posición index (< size), recorriendo desde el extremo más cercano
+    Index nodeAt(std::size_t index) const {
+        Index current;
+
+        if (index < size / 2) {
+            current = head;
+            for (std::size_t i = 0; i < index; ++i) {
+                current = nodes[current].next;
+            }
+        }else {
+            current = tail;
+            for (std::size_t i = size - 1; i > index; --i) {
+                current = nodes[current].prev;
+            }
+        }
+
+        return current;
+    }
+
+    // Enlaza el nodo current justo antes de following (al final si es kNone)
+    void linkBefore(Index current, Index following) {
+        Index previous = following == kNone ? tail : nodes[following].prev;
+
+        nodes[current].next = following;
+        nodes[current].prev = previous;
+
+        if (previous != kNone) {
+            nodes[previous].next = current;
+        }else {
+            head = current;
+        }
+
+        if (following != kNone) {
+            nodes[following].prev = current;
+        }else {
+            tail = current;
+        }
+
+        ++size;
+    }
+
+    // Desenlaza un nodo de la lista sin liberarlo
+    void detach(Index current) {
+        Node& node = nodes[current];
+
+        if (node.prev != kNone) {
+            nodes[node.prev].next = node.next;
+        }else {
+            head = node.next;
+        }
+
+        if (node.next != kNone) {
+            nodes[node.next].prev = node.prev;
+        }else {
+            tail = node.prev;
+        }
+
+        --size;
+    }
+
+    // Desenlaza y libera un nodo de la lista
+    void unlink(Index current) {
+        detach(current);
+        release(current);
+    }
+
+public:
+    // Iterador bidireccional. IsConst distingue iterator de const_iterator.
+    // Guarda el índice del nodo, así que sigue siendo válido aunque el array
+    // crezca, mientras su elemento no se borre y no se llame a compact().
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator() : node(kNone), list(nullptr) {}
+
+        // Un iterator se puede convertir en const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node(other.node), list(other.list) {}
+
+        reference operator*() const {
+            return *list->nodes[node].value();
+        }
+
+        pointer operator->() const {
+            return list->nodes[node].value();
+        }
+
+        BasicIterator& operator++() {
+            node = list->nodes[node].next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        BasicIterator& operator--() {
+            node = node != kNone ? list->nodes[node].prev : list->tail;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class CompactDoublyLinkedList;
+        template <bool>
+        friend class BasicIterator;
+
+        using List = typename std::conditional<IsConst, const CompactDoublyLinkedList, CompactDoublyLinkedList>::type;
+
+        Index node;   // kNone es end()
+        List* list;
+
+        BasicIterator(Index current, List* parent) : node(current), list(parent) {}
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Constructor por defecto: no reserva nada hasta el primer elemento
+    CompactDoublyLinkedList()
+        : nodes(nullptr), capacity(0), used(0), freeHead(kNone), head(kNone), tail(kNone), size(0) {}
+
+    // Constructor de copia: la copia queda compacta
+    CompactDoublyLinkedList(const CompactDoublyLinkedList& other)
+        : nodes(nullptr), capacity(0), used(0), freeHead(kNone), head(kNone), tail(kNone), size(0) {
+        copy(other);
+    }
+
+    // Constructor de movimiento: se lleva el array de other sin copiarlo
+    CompactDoublyLinkedList(CompactDoublyLinkedList&& other) noexcept
+        : nodes(nullptr), capacity(0), used(0), freeHead(kNone), head(kNone), tail(kNone), size(0) {
+        steal(other);
+    }
+
+    // Asignación = (Deep copy)
+    CompactDoublyLinkedList& operator=(const CompactDoublyLinkedList& other) {
+        if (this != &other) {
+            clear();
+            copy(other);
+        }
+
+        return *this;
+    }
+
+    // Asignación por movimiento
+    CompactDoublyLinkedList& operator=(CompactDoublyLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            delete[] nodes;
+            nodes = nullptr;
+            capacity = 0;
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    // Destructor
+    ~CompactDoublyLinkedList() {
+        clear();
+        delete[] nodes;
+    }
+
+    // Comprueba si la lista está vacía
+    bool empty() const {
+        return size == 0;
+    }
+
+    // Devuelve el tamaño de la lista
+    std::size_t getSize() const {
+        return size;
+    }
+
+    // Nodos que caben en el array sin volver a crecer
+    std::size_t getCapacity() const {
+        return capacity;
+    }
+
+    // Reserva sitio para al menos n nodos
+    void reserve(std::size_t n) {
+        if (n > kNone) {
+            throw std::length_error("list is full");
+        }
+        if (n > capacity) {
+            relocate(n, false);
+        }
+    }
+
+    // Elimina todos los elementos. El array se conserva para reutilizarlo.
+    void clear() {
+        for (Index current = head; current != kNone; current = nodes[current].next) {
+            nodes[current].value()->~T();
+        }
+
+        used = 0;
+        freeHead = kNone;
+        head = kNone;
+        tail = kNone;
+        size = 0;
+    }
+
+    // Coloca los nodos en el orden de la lista, seguidos desde el índice 0, y
+    // vacía la lista de libres. Invalida los iteradores. O(n).
+    void compact() {
+        if (capacity > 0) {
+            relocate(capacity, true);
+        }
+    }
+
+    // Añade un elemento al principio
+    void pushFront(const T& value) {
+        linkBefore(acquire(value), head);
+    }
+
+    // Añade un elemento al final
+    void pushBack(const T& value) {
+        linkBefore(acquire(value), kNone);
+    }
+
+    // Añade un elemento en un índice especificado
+    void insert(const std::size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        Index following = index == size ? kNone : nodeAt(index);
+        linkBefore(acquire(value), following);
+    }
+
+    // Elimina la primera aparición de un elemento
+    bool remove(const T& value) {
+        Index current = head;
+        while (current != kNone && *nodes[current].value() != value) {
+            current = nodes[current].next;
+        }
+
+        if (current == kNone) {
+            return false;
+        }
+
+        unlink(current);
+        return true;
+    }
+
+    // Elimina un elemento en un índice especificado
+    void removeAt(std::size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        unlink(nodeAt(index));
+    }
+
+    // Devuelve un elemento en una posición especificada
+    T& at(const std::size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        return *nodes[nodeAt(index)].value();
+    }
+
+    iterator begin() {
+        return iterator(head, this);
+    }
+
+    iterator end() {
+        return iterator(kNone, this);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head, this);
+    }
+
+    const_iterator end() const {
+        return const_iterator(kNone, this);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const {
+        return rbegin();
+    }
+
+    const_reverse_iterator crend() const {
+        return rend();
+    }
+
+    // Inserta value justo antes de position en O(1) (al final si es end()).
+    // Devuelve un iterador al nuevo elemento.
+    iterator insert(const_iterator position, const T& value) {
+        Index current = acquire(value);
+        linkBefore(current, position.node);
+        return iterator(current, this);
+    }
+
+    // Elimina el elemento de position en O(1). Devuelve un iterador al siguiente.
+    iterator erase(const_iterator position) {
+        if (position.node == kNone) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        Index following = nodes[position.node].next;
+        unlink(position.node);
+        return iterator(following, this);
+    }
+
+    // Lleva el elemento de position al principio en O(1), sin copiarlo: el
+    // iterador sigue apuntando a él. Devuelve begin().
+    iterator move_to_front(const_iterator position) {
+        if (position.node == kNone) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        if (position.node != head) {
+            detach(position.node);
+            linkBefore(position.node, head);
+        }
+
+        return begin();
+    }
+
+    void printForward() const {
+        if (empty()) {
+            std::cout << "[Empty list]\n";
+            return;
+        }
+
+        Index current = head;
+        std::cout << "Head -> ";
+        while (current != kNone) {
+            std::cout << *nodes[current].value();
+            if (nodes[current].next != kNone) {
+                std::cout << " <-> ";
+            }
+            current = nodes[current].next;
+        }
+        std::cout << " <- Tail\n";
+    }
+
+    void printBackward() const {
+        if (empty()) {
+            std::cout << "[Empty list]\n";
+            return;
+        }
+
+        Index current = tail;
+        std::cout << "Tail -> ";
+        while (current != kNone) {
+            std::cout << *nodes[current].value();
+            if (nodes[current].prev != kNone) {
+                std::cout << " <-> ";
+            }
+            current = nodes[current].prev;
+        }
+        std::cout << " <- Head\n";
+    }
+};
@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+#include "CompactDoublyLinkedList.h"
+#include "DoublyLinkedList.h"
+#include "ListVerification.h"
+#include "RawDoublyLinkedList.h"
+
+// BENCHMARK: CompactDoublyLinkedList (array de nodos con índices de 32 bits)
+// frente a RawDoublyLinkedList y DoublyLinkedList
+//
+// Uso: ./CompactDoublyLinkedListBenchmark [exponente_maximo]
+// Para listas de 10^4 a 10^exponente_maximo (10^6 por defecto) elementos de
+// 8 bytes (std::uint64_t) y de 16 bytes (dos std::uint64_t) se mide:
+//  - "memoria": bytes pedidos al heap por elemento, contando cada new/delete
+//  - "pushBack": llenar la lista, en ns por elemento
+//  - "recorrido": sumar la lista con iteradores, en ns por elemento y en GB/s
+//    de datos útiles (n · sizeof(T) bytes)
+//      · "en orden": recién llena, cada nodo detrás del anterior en memoria
+//      · "desordenada": después de n move_to_front de elementos al azar, el
+//        orden de la lista ya no es el de la memoria
+//      · "tras compact()": CompactDoublyLinkedList con los nodos recolocados
+// Antes se comprueba con operaciones al azar frente a un std::vector que
+// CompactDoublyLinkedList da el mismo contenido, también después de compact().
+
+// Elemento de 16 bytes: una clave y un valor
+struct Pair {
+    std::uint64_t key;
+    std::uint64_t value;
+
+    bool operator!=(const Pair& other) const {
+        return key != other.key || value != other.value;
+    }
+};
+
+static void makeValue(std::size_t i, std::uint64_t& out) {
+    out = i;
+}
+
+static void makeValue(std::size_t i, Pair& out) {
+    out = Pair{i, i * 3};
+}
+
+static std::uint64_t sumOf(std::uint64_t value) {
+    return value;
+}
+
+static std::uint64_t sumOf(const Pair& pair) {
+    return pair.key + pair.value;
+}
+
+using List = CompactDoublyLinkedList<int>;
+
+// Lo propio de CompactDoublyLinkedList, además de verifyDoublyLinkedList
+static void verifyCompact() {
+    // Los iteradores guardan índices: siguen valiendo aunque el array crezca
+    List growing;
+    growing.pushBack(7);
+    List::iterator first = growing.begin();
+    for (int i = 0; i < 1000; ++i) {
+        growing.pushBack(i);
+    }
+    check(*first == 7 && first == growing.begin(), "growth invalidates iterators");
+
+    // Insertar un elemento de la propia lista justo cuando el array está
+    // lleno: el valor vive en el array que se libera al crecer
+    for (int insertion = 0; insertion < 4; ++insertion) {
+        CompactDoublyLinkedList<std::string> strings;
+        std::vector<std::string> expectedStrings;
+        while (strings.getSize() < strings.getCapacity() || strings.empty()) {
+            std::string value = "elemento " + std::to_string(strings.getSize()) + " con texto fuera del objeto";
+            strings.pushBack(value);
+            expectedStrings.push_back(value);
+        }
+        std::string copied = expectedStrings.back();
+        switch (insertion) {
+            case 0:
+                strings.pushBack(strings.at(strings.getSize() - 1));
+                expectedStrings.push_back(copied);
+                break;
+            case 1:
+                strings.pushFront(strings.at(strings.getSize() - 1));
+                expectedStrings.insert(expectedStrings.begin(), copied);
+                break;
+            case 2:
+                strings.insert(1, strings.at(strings.getSize() - 1));
+                expectedStrings.insert(expectedStrings.begin() + 1, copied);
+                break;
+            default:
+                strings.insert(strings.begin(), strings.at(strings.getSize() - 1));
+                expectedStrings.insert(expectedStrings.begin(), copied);
+                break;
+        }
+        check(std::equal(strings.begin(), strings.end(), expectedStrings.begin(), expectedStrings.end()),
+              "inserting an element of the list itself while growing");
+    }
+}
+
+template <typename L, typename T>
+static void fill(L& list, std::size_t n) {
+    T value;
+    for (std::size_t i = 0; i < n; ++i) {
+        makeValue(i, value);
+        list.pushBack(value);
+    }
+}
+
+// Lleva al principio n elementos al azar, de los que se guarda un iterador al llenar
+template <typename L>
+static void shuffle(L& list, std::size_t n) {
+    std::vector<typename L::iterator> handles;
+    handles.reserve(n);
+    for (typename L::iterator it = list.begin(); it != list.end(); ++it) {
+        handles.push_back(it);
+    }
+
+    Random random(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        list.move_to_front(handles[random.next(n)]);
+    }
+}
+
+template <typename L, typename T>
+static void timeScan(const std::string& name, const L& list, std::size_t n, std::uint64_t expectedSum) {
+    // Se repite hasta recorrer al menos 10^7 elementos para que el tiempo sea medible
+    std::size_t rounds = n >= 10000000 ? 1 : 10000000 / n;
+    std::uint64_t sum = 0;
+
+    Stopwatch watch;
+    for (std::size_t round = 0; round < rounds; ++round) {
+        for (typename L::const_iterator it = list.begin(); it != list.end(); ++it) {
+            sum += sumOf(*it);
+        }
+        doNotOptimize(sum);
+    }
+    double nsPerElement = watch.elapsedNanoseconds() / static_cast<double>(n * rounds);
+    check(sum == expectedSum * rounds, "scan sum mismatch");
+
+    std::cout << std::left << std::setw(34) << name
+              << std::right << std::setw(12) << n
+              << std::setw(12) << std::fixed << std::setprecision(2) << nsPerElement
+              << std::setw(12) << static_cast<double>(sizeof(T)) / nsPerElement << " GB/s\n";
+}
+
+template <typename L, typename T>
+static void measure(const std::string& name, std::size_t n) {
+    std::size_t before = liveBytes;
+    std::uint64_t expectedSum = 0;
+    {
+        T value;
+        for (std::size_t i = 0; i < n; ++i) {
+            makeValue(i, value);
+            expectedSum += sumOf(value);
+        }
+    }
+
+    L list;
+    Stopwatch watch;
+    fill<L, T>(list, n);
+    double pushBackNs = watch.elapsedNanoseconds() / static_cast<double>(n);
+    std::size_t bytes = liveBytes - before;
+
+    std::cout << std::left << std::setw(34) << ("memoria " + name)
+              << std::right << std::setw(12) << n
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << static_cast<double>(bytes) / static_cast<double>(n) << " bytes/elem\n";
+    std::cout << std::left << std::setw(34) << ("pushBack " + name)
+              << std::right << std::setw(12) << n
+              << std::setw(12) << pushBackNs << "\n";
+
+    timeScan<L, T>("recorrido en orden " + name, list, n, expectedSum);
+    shuffle(list, n);
+    timeScan<L, T>("recorrido desordenada " + name, list, n, expectedSum);
+}
+
+template <typename T>
+static void measureCompact(std::size_t n) {
+    std::uint64_t expectedSum = 0;
+    CompactDoublyLinkedList<T> list;
+    fill<CompactDoublyLinkedList<T>, T>(list, n);
+    for (const T& value : list) {
+        expectedSum += sumOf(value);
+    }
+    shuffle(list, n);
+
+    Stopwatch watch;
+    list.compact();
+    std::cout << std::left << std::setw(34) << "compact() compacta"
+              << std::right << std::setw(12) << n
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << watch.elapsedNanoseconds() / static_cast<double>(n) << "\n";
+    timeScan<CompactDoublyLinkedList<T>, T>("recorrido tras compact() compacta", list, n, expectedSum);
+}
+
+template <typename T>
+static void measureAll(std::size_t maxExp) {
+    for (std::size_t exp = 4; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        measure<DoublyLinkedList<T>, T>("shared_ptr", n);
+        measure<RawDoublyLinkedList<T>, T>("raw", n);
+        measure<CompactDoublyLinkedList<T>, T>("compacta", n);
+        measureCompact<T>(n);
+        std::cout << "\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 6);
+
+    verifyDoublyLinkedList<List>(20000, [](List& list) {
+        list.compact();
+        check(list.getCapacity() >= list.getSize(), "compact() loses capacity");
+    });
+    verifyCompact();
+    std::cout << "Verificacion frente a std::vector: OK\n\n";
+
+    std::cout << "lista                                        n       ns/op\n";
+    std::cout << "Elementos de 8 bytes\n";
+    measureAll<std::uint64_t>(maxExp);
+    std::cout << "Elementos de 16 bytes\n";
+    measureAll<Pair>(maxExp);
+
+    return 0;
+}
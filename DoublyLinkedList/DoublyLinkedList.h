@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
 template <typename T>
 class DoublyLinkedList {
@@ -31,7 +35,138 @@ private:
         }
     }
 
+    // Nodo en la posición index (< size), recorriendo desde el extremo más cercano
+    std::shared_ptr<Node> nodeAt(std::size_t index) const {
+        std::shared_ptr<Node> current;
+
+        if (index < size / 2) {
+            current = head;
+            for (std::size_t i= 0; i < index; ++i) {
+                current = current->next;
+            }
+        }else {
+            current = tail;
+            for (std::size_t i = size - 1; i > index; --i) {
+                current = current->prev.lock();
+            }
+        }
+
+        return current;
+    }
+
+    // Se queda con los nodos de other (esta lista tiene que estar vacía)
+    void steal(DoublyLinkedList& other) {
+        head = std::move(other.head);
+        tail = std::move(other.tail);
+        size = other.size;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+    }
+
+    // shared_ptr que es dueño de current: el next de su anterior, o head
+    std::shared_ptr<Node>& owner(Node* current) {
+        std::shared_ptr<Node> previous = current->prev.lock();
+        return previous != nullptr ? previous->next : head;
+    }
+
+    // Desenlaza current de la lista sin liberarlo: devuelve el único
+    // shared_ptr que queda apuntando a él
+    std::shared_ptr<Node> detach(Node* current) {
+        std::shared_ptr<Node> previous = current->prev.lock();
+        std::shared_ptr<Node> self = std::move(owner(current));
+        std::shared_ptr<Node> nextNode = std::move(self->next);
+
+        if (nextNode != nullptr) {
+            nextNode->prev = previous;
+        }else {
+            tail = previous;
+        }
+
+        if (previous != nullptr) {
+            previous->next = std::move(nextNode);
+        }else {
+            head = std::move(nextNode);
+        }
+
+        self->prev.reset();
+        --size;
+        return self;
+    }
+
 public:
+    // Iterador bidireccional. IsConst distingue iterator de const_iterator.
+    // Guarda el nodo sin poseerlo, así que sigue siendo válido mientras su
+    // elemento no se borre, aunque se inserten o borren otros. end() es el
+    // nodo nulo y guarda la lista para que --end() lleve a tail.
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator() : node(nullptr), list(nullptr) {}
+
+        // Un iterator se puede convertir en const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node(other.node), list(other.list) {}
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        BasicIterator& operator++() {
+            node = node->next.get();
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        BasicIterator& operator--() {
+            node = node != nullptr ? node->prev.lock().get() : list->tail.get();
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class DoublyLinkedList;
+        template <bool>
+        friend class BasicIterator;
+
+        Node* node;                     // nullptr es end()
+        const DoublyLinkedList* list;
+
+        BasicIterator(Node* current, const DoublyLinkedList* parent) : node(current), list(parent) {}
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     // Constructor por defecto
     DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
@@ -42,6 +177,12 @@ public:
         copy(other);
     }
 
+    // Constructor de movimiento: se lleva los nodos de other sin copiarlos
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept
+        : head(nullptr), tail(nullptr), size(0) {
+        steal(other);
+    }
+
     // Asignación = (Deep copy)
     DoublyLinkedList& operator=(const DoublyLinkedList& other) {
         if (this != &other) {
@@ -52,6 +193,16 @@ public:
         return *this;
     }
 
+    // Asignación por movimiento
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+
+        return *this;
+    }
+
     // Destructor
     ~DoublyLinkedList() {
         clear();
@@ -67,10 +218,16 @@ public:
         return size;
     }
 
-    // Elimina todos los elementos de la lista
+    // Elimina todos los elementos de la lista. Se sueltan los nodos de uno en
+    // uno: con head = nullptr cada nodo destruiría al siguiente desde su propio
+    // destructor y una lista larga desbordaría la pila.
     void clear() {
-        head = nullptr;
         tail = nullptr;
+        std::shared_ptr<Node> current = std::move(head);
+        while (current != nullptr) {
+            // El nodo se destruye con su next ya vacío: no arrastra al resto
+            current = std::move(current->next);
+        }
         size = 0;
     }
 
@@ -219,21 +376,185 @@ public:
             throw std::out_of_range("index out of range");
         }
 
-        std::shared_ptr<Node> current;
+        return nodeAt(index)->data;
+    }
 
-        if (index < size / 2) {
-            current = head;
-            for (std::size_t i= 0; i < index; ++i) {
-                current = current->next;
-            }
+    // Mueve todos los nodos de other al final de esta lista en O(1). other queda vacía.
+    void append(DoublyLinkedList&& other) {
+        splice(size, other);
+    }
+
+    // Mueve todos los nodos de other a la posición index, sin copiarlos.
+    // O(1) al principio y al final; en otra posición hay que llegar al nodo
+    // desde el extremo más cercano. other queda vacía.
+    void splice(std::size_t index, DoublyLinkedList& other) {
+        if (&other == this) {
+            throw std::invalid_argument("cannot splice a list into itself");
+        }
+        if (index > size) {
+            throw std::out_of_range("index out of range");
+        }
+        if (other.empty()) {
+            return;
+        }
+
+        if (empty()) {
+            head = other.head;
+            tail = other.tail;
+        }else if (index == 0) {
+            other.tail->next = head;
+            head->prev = other.tail;
+            head = other.head;
+        }else if (index == size) {
+            other.head->prev = tail;
+            tail->next = other.head;
+            tail = other.tail;
         }else {
-            current = tail;
-            for (std::size_t i = size; i > index; --i) {
-                current = current->prev.lock();
-            }
+            // Los nodos de other quedan entre previous y current
+            std::shared_ptr<Node> current = nodeAt(index);
+            std::shared_ptr<Node> previous = current->prev.lock();
+
+            previous->next = other.head;
+            other.head->prev = previous;
+            other.tail->next = current;
+            current->prev = other.tail;
+        }
+
+        size += other.size;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+    }
+
+    // Corta la lista en index: esta se queda con [0, index) y devuelve una
+    // lista nueva con [index, getSize()), sin copiar nodos. Cuesta llegar al
+    // nodo index desde el extremo más cercano.
+    DoublyLinkedList splitAt(std::size_t index) {
+        if (index > size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        DoublyLinkedList rest;
+        if (index == size) {
+            return rest;
+        }
+
+        if (index == 0) {
+            rest.steal(*this);
+            return rest;
+        }
+
+        std::shared_ptr<Node> current = nodeAt(index);
+        std::shared_ptr<Node> previous = current->prev.lock();
+
+        previous->next = nullptr;
+        current->prev.reset();
+
+        rest.head = current;
+        rest.tail = tail;
+        rest.size = size - index;
+
+        tail = previous;
+        size = index;
+        return rest;
+    }
+
+    iterator begin() {
+        return iterator(head.get(), this);
+    }
+
+    iterator end() {
+        return iterator(nullptr, this);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head.get(), this);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, this);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const {
+        return rbegin();
+    }
+
+    const_reverse_iterator crend() const {
+        return rend();
+    }
+
+    // Inserta value justo antes de position en O(1) (al final si es end()).
+    // Devuelve un iterador al nuevo elemento.
+    iterator insert(const_iterator position, const T& value) {
+        if (position.node == nullptr) {
+            pushBack(value);
+            return iterator(tail.get(), this);
+        }
+
+        Node* current = position.node;
+        std::shared_ptr<Node> newNode = std::make_shared<Node>(value);
+        std::shared_ptr<Node>& link = owner(current);
+
+        newNode->prev = current->prev;
+        newNode->next = std::move(link);
+        current->prev = newNode;
+        link = newNode;
+
+        ++size;
+        return iterator(newNode.get(), this);
+    }
+
+    // Elimina el elemento de position en O(1). Devuelve un iterador al siguiente.
+    iterator erase(const_iterator position) {
+        if (position.node == nullptr) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        Node* following = position.node->next.get();
+        detach(position.node);
+        return iterator(following, this);
+    }
+
+    // Lleva el elemento de position al principio en O(1), sin copiarlo: el
+    // iterador sigue apuntando a él. Devuelve begin().
+    iterator move_to_front(const_iterator position) {
+        if (position.node == nullptr) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        if (position.node != head.get()) {
+            std::shared_ptr<Node> self = detach(position.node);
+            self->next = head;
+            head->prev = self;
+            head = std::move(self);
+            ++size;
         }
 
-        return current->data;
+        return begin();
     }
 
     void printForward() const {
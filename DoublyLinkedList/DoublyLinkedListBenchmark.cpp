@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+#include "DoublyLinkedList.h"
+#include "ListVerification.h"
+#include "RawDoublyLinkedList.h"
+
+// BENCHMARK: RawDoublyLinkedList (punteros crudos) frente a DoublyLinkedList (shared_ptr/weak_ptr)
+//
+// Uso: ./DoublyLinkedListBenchmark [exponente_maximo] [elementos_lista_grande]
+// Para listas de 10^4 a 10^exponente_maximo (10^6 por defecto) de int se mide:
+//  - "memoria": bytes pedidos al heap por elemento, contando cada new/delete
+//  - "pushBack": llenar la lista, en ns por elemento
+//  - "clear": vaciarla, en ns por elemento
+//  - "move_to_front": llevar al principio un elemento al azar del que se
+//    guardó un iterador, en ns por operación; frente a "remove+pushFront",
+//    que tiene que buscarlo recorriendo la lista (solo 20 operaciones)
+// Al final se llena y se vacía una lista de 'elementos_lista_grande' (5·10^6
+// por defecto) con cada versión: antes, el clear() de DoublyLinkedList
+// destruía los nodos en cadena y desbordaba la pila con listas así.
+// Antes se comprueba con operaciones al azar frente a un std::vector que las dos
+// listas dan el mismo contenido, recorriéndolas también desde el final con at().
+
+template <typename List>
+static void fill(List& list, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(static_cast<int>(i));
+    }
+}
+
+template <typename List>
+static void measure(const std::string& name, std::size_t n) {
+    std::size_t before = liveBytes;
+    List list;
+
+    Stopwatch watch;
+    fill(list, n);
+    double pushBackNs = watch.elapsedNanoseconds() / static_cast<double>(n);
+    std::size_t bytes = liveBytes - before;
+
+    watch.reset();
+    list.clear();
+    double clearNs = watch.elapsedNanoseconds() / static_cast<double>(n);
+    check(liveBytes == before, "clear() does not free every node");
+
+    std::cout << std::left << std::setw(28) << ("memoria " + name)
+              << std::right << std::setw(12) << n
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << static_cast<double>(bytes) / static_cast<double>(n) << " bytes/elem\n";
+    printResult("pushBack " + name, n, pushBackNs);
+    printResult("clear " + name, n, clearNs);
+}
+
+template <typename List>
+static void timeMoveToFront(const std::string& name, std::size_t n) {
+    List list;
+    std::vector<typename List::iterator> handles;
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(static_cast<int>(i));
+        handles.push_back(std::prev(list.end()));
+    }
+
+    Random random(n);
+    Stopwatch watch;
+    for (std::size_t i = 0; i < n; ++i) {
+        list.move_to_front(handles[random.next(n)]);
+    }
+    printResult("move_to_front " + name, n, watch.elapsedNanoseconds() / static_cast<double>(n));
+    check(list.getSize() == n, "move_to_front changes the size");
+
+    std::size_t operations = n < 20 ? n : 20;
+    watch.reset();
+    for (std::size_t i = 0; i < operations; ++i) {
+        int value = static_cast<int>(random.next(n));
+        list.remove(value);
+        list.pushFront(value);
+    }
+    printResult("remove+pushFront " + name, operations, watch.elapsedNanoseconds() / static_cast<double>(operations));
+    check(list.getSize() == n, "remove+pushFront changes the size");
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 6);
+    std::size_t large = argOrDefault(argc, argv, 2, 5000000);
+
+    verifyDoublyLinkedList<DoublyLinkedList<int>>(20000);
+    verifyDoublyLinkedList<RawDoublyLinkedList<int>>(20000);
+    std::cout << "Verificacion frente a std::vector: OK\n\n";
+
+    std::cout << "lista                                   n         ns/op\n";
+    for (std::size_t exp = 4; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        measure<DoublyLinkedList<int>>("shared_ptr", n);
+        measure<RawDoublyLinkedList<int>>("raw", n);
+        timeMoveToFront<DoublyLinkedList<int>>("shared_ptr", n);
+        timeMoveToFront<RawDoublyLinkedList<int>>("raw", n);
+        std::cout << "\n";
+    }
+
+    std::cout << "Lista grande\n";
+    measure<DoublyLinkedList<int>>("shared_ptr", large);
+    measure<RawDoublyLinkedList<int>>("raw", large);
+
+    return 0;
+}
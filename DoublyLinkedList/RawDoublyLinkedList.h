@@ -0,0 +1,550 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+/*
+    Lista doblemente enlazada con punteros crudos.
+
+    Misma interfaz que DoublyLinkedList, pero cada nodo es solo el valor y dos
+    Node*: sin bloque de control, sin contadores de referencias atómicos y sin
+    weak_ptr que bloquear para ir hacia atrás. La lista es dueña de sus nodos
+    y los libera con un bucle en clear(), así que destruir una lista de
+    millones de elementos no depende de la profundidad de la pila.
+*/
+
+template <typename T>
+class RawDoublyLinkedList {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        Node* prev;
+
+        Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+    };
+
+    Node* head;
+    Node* tail;
+    std::size_t size;
+
+    void copy(const RawDoublyLinkedList& other) {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+
+        Node* current = other.head;
+        while (current != nullptr) {
+            pushBack(current->data);
+            current = current->next;
+        }
+    }
+
+    // Nodo en la posición index (< size), recorriendo desde el extremo más cercano
+    Node* nodeAt(std::size_t index) const {
+        Node* current;
+
+        if (index < size / 2) {
+            current = head;
+            for (std::size_t i= 0; i < index; ++i) {
+                current = current->next;
+            }
+        }else {
+            current = tail;
+            for (std::size_t i = size - 1; i > index; --i) {
+                current = current->prev;
+            }
+        }
+
+        return current;
+    }
+
+    // Desenlaza un nodo de la lista sin liberarlo
+    void detach(Node* current) {
+        if (current->prev != nullptr) {
+            current->prev->next = current->next;
+        }else {
+            head = current->next;
+        }
+
+        if (current->next != nullptr) {
+            current->next->prev = current->prev;
+        }else {
+            tail = current->prev;
+        }
+
+        current->next = nullptr;
+        current->prev = nullptr;
+        --size;
+    }
+
+    // Desenlaza y libera un nodo de la lista
+    void unlink(Node* current) {
+        detach(current);
+        delete current;
+    }
+
+    // Se queda con los nodos de other (esta lista tiene que estar vacía)
+    void steal(RawDoublyLinkedList& other) {
+        head = other.head;
+        tail = other.tail;
+        size = other.size;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+    }
+
+public:
+    // Iterador bidireccional. IsConst distingue iterator de const_iterator.
+    // Sigue siendo válido mientras su elemento no se borre, aunque se inserten
+    // o borren otros. end() es el nodo nulo y guarda la lista para que
+    // --end() lleve a tail.
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator() : node(nullptr), list(nullptr) {}
+
+        // Un iterator se puede convertir en const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node(other.node), list(other.list) {}
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        BasicIterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        BasicIterator& operator--() {
+            node = node != nullptr ? node->prev : list->tail;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class RawDoublyLinkedList;
+        template <bool>
+        friend class BasicIterator;
+
+        Node* node;                     // nullptr es end()
+        const RawDoublyLinkedList* list;
+
+        BasicIterator(Node* current, const RawDoublyLinkedList* parent) : node(current), list(parent) {}
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Constructor por defecto
+    RawDoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+
+    // Constructor de copia
+    RawDoublyLinkedList(const RawDoublyLinkedList& other)
+        : head(nullptr), tail(nullptr), size(0) {
+        copy(other);
+    }
+
+    // Constructor de movimiento: se lleva los nodos de other sin copiarlos
+    RawDoublyLinkedList(RawDoublyLinkedList&& other) noexcept
+        : head(nullptr), tail(nullptr), size(0) {
+        steal(other);
+    }
+
+    // Asignación = (Deep copy)
+    RawDoublyLinkedList& operator=(const RawDoublyLinkedList& other) {
+        if (this != &other) {
+            clear();
+            copy(other);
+        }
+
+        return *this;
+    }
+
+    // Asignación por movimiento
+    RawDoublyLinkedList& operator=(RawDoublyLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    // Destructor
+    ~RawDoublyLinkedList() {
+        clear();
+    }
+
+    // Comprueba si la lista está vacía
+    bool empty() const {
+        return head == nullptr;
+    }
+
+    // Devuelve el tamaño de la lista
+    std::size_t getSize() const {
+        return size;
+    }
+
+    // Elimina todos los elementos de la lista, de uno en uno
+    void clear() {
+        Node* current = head;
+        while (current != nullptr) {
+            Node* aux = current;
+            current = current->next;
+            delete aux;
+        }
+
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+
+    // Añade un elemento al principio
+    void pushFront(const T& value) {
+        Node* newNode = new Node(value);
+
+        if (empty()) {
+            head = tail = newNode;
+        }else {
+            newNode->next = head;
+            head->prev = newNode;
+            head = newNode;
+        }
+
+        ++size;
+    }
+
+    // Añade un elemento al final
+    void pushBack(const T& value) {
+        Node* newNode = new Node(value);
+
+        if (empty()) {
+            head = tail = newNode;
+        }else {
+            newNode->prev = tail;
+            tail->next = newNode;
+            tail = newNode;
+        }
+
+        ++size;
+    }
+
+    // Añade un elemento en un índice especificado
+    void insert(const std::size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        if (index == 0) {
+            pushFront(value);
+            return;
+        }
+
+        if (index == size) {
+            pushBack(value);
+            return;
+        }
+
+        Node* current = nodeAt(index);
+        Node* previous = current->prev;
+        Node* newNode = new Node(value);
+
+        newNode->next = current;
+        newNode->prev = previous;
+
+        previous->next = newNode;
+        current->prev = newNode;
+
+        ++size;
+    }
+
+    // Elimina la primera aparición de un elemento
+    bool remove(const T& value) {
+        Node* current = head;
+        while (current != nullptr && current->data != value) {
+            current = current->next;
+        }
+
+        if (current == nullptr) {
+            return false;
+        }
+
+        unlink(current);
+        return true;
+    }
+
+    // Elimina un elemento en un índice especificado
+    void removeAt(std::size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        unlink(nodeAt(index));
+    }
+
+    // Devuelve un elemento en una posición especificada
+    T& at(const std::size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        return nodeAt(index)->data;
+    }
+
+    // Mueve todos los nodos de other al final de esta lista en O(1). other queda vacía.
+    void append(RawDoublyLinkedList&& other) {
+        splice(size, other);
+    }
+
+    // Mueve todos los nodos de other a la posición index, sin copiarlos.
+    // O(1) al principio y al final; en otra posición hay que llegar al nodo
+    // desde el extremo más cercano. other queda vacía.
+    void splice(std::size_t index, RawDoublyLinkedList& other) {
+        if (&other == this) {
+            throw std::invalid_argument("cannot splice a list into itself");
+        }
+        if (index > size) {
+            throw std::out_of_range("index out of range");
+        }
+        if (other.empty()) {
+            return;
+        }
+
+        if (empty()) {
+            head = other.head;
+            tail = other.tail;
+        }else if (index == 0) {
+            other.tail->next = head;
+            head->prev = other.tail;
+            head = other.head;
+        }else if (index == size) {
+            other.head->prev = tail;
+            tail->next = other.head;
+            tail = other.tail;
+        }else {
+            // Los nodos de other quedan entre previous y current
+            Node* current = nodeAt(index);
+            Node* previous = current->prev;
+
+            previous->next = other.head;
+            other.head->prev = previous;
+            other.tail->next = current;
+            current->prev = other.tail;
+        }
+
+        size += other.size;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+    }
+
+    // Corta la lista en index: esta se queda con [0, index) y devuelve una
+    // lista nueva con [index, getSize()), sin copiar nodos. Cuesta llegar al
+    // nodo index desde el extremo más cercano.
+    RawDoublyLinkedList splitAt(std::size_t index) {
+        if (index > size) {
+            throw std::out_of_range("index out of range");
+        }
+
+        RawDoublyLinkedList rest;
+        if (index == size) {
+            return rest;
+        }
+
+        if (index == 0) {
+            rest.steal(*this);
+            return rest;
+        }
+
+        Node* current = nodeAt(index);
+        Node* previous = current->prev;
+
+        previous->next = nullptr;
+        current->prev = nullptr;
+
+        rest.head = current;
+        rest.tail = tail;
+        rest.size = size - index;
+
+        tail = previous;
+        size = index;
+        return rest;
+    }
+
+    iterator begin() {
+        return iterator(head, this);
+    }
+
+    iterator end() {
+        return iterator(nullptr, this);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head, this);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, this);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const {
+        return rbegin();
+    }
+
+    const_reverse_iterator crend() const {
+        return rend();
+    }
+
+    // Inserta value justo antes de position en O(1) (al final si es end()).
+    // Devuelve un iterador al nuevo elemento.
+    iterator insert(const_iterator position, const T& value) {
+        if (position.node == nullptr) {
+            pushBack(value);
+            return iterator(tail, this);
+        }
+
+        if (position.node == head) {
+            pushFront(value);
+            return iterator(head, this);
+        }
+
+        Node* current = position.node;
+        Node* newNode = new Node(value);
+
+        newNode->next = current;
+        newNode->prev = current->prev;
+
+        current->prev->next = newNode;
+        current->prev = newNode;
+
+        ++size;
+        return iterator(newNode, this);
+    }
+
+    // Elimina el elemento de position en O(1). Devuelve un iterador al siguiente.
+    iterator erase(const_iterator position) {
+        if (position.node == nullptr) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        Node* following = position.node->next;
+        unlink(position.node);
+        return iterator(following, this);
+    }
+
+    // Lleva el elemento de position al principio en O(1), sin copiarlo: el
+    // iterador sigue apuntando a él. Devuelve begin().
+    iterator move_to_front(const_iterator position) {
+        if (position.node == nullptr) {
+            throw std::out_of_range("iterator out of range");
+        }
+
+        Node* current = position.node;
+        if (current != head) {
+            detach(current);
+            current->next = head;
+            head->prev = current;
+            head = current;
+            ++size;
+        }
+
+        return begin();
+    }
+
+    void printForward() const {
+        if (empty()) {
+            std::cout << "[Empty list]\n";
+            return;
+        }
+
+        Node* current = head;
+        std::cout << "Head -> ";
+        while (current != nullptr) {
+            std::cout << current->data;
+            if (current->next != nullptr) {
+                std::cout << " <-> ";
+            }
+            current = current->next;
+        }
+        std::cout << " <- Tail\n";
+    }
+
+    void printBackward() const {
+        if (empty()) {
+            std::cout << "[Empty list]\n";
+            return;
+        }
+
+        Node* current = tail;
+        std::cout << "Tail -> ";
+        while (current != nullptr) {
+            std::cout << current->data;
+            if (current->prev != nullptr) {
+                std::cout << " <-> ";
+            }
+            current = current->prev;
+        }
+        std::cout << " <- Head\n";
+    }
+};
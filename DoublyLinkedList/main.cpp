@@ -1,5 +1,9 @@
+#include <algorithm>
 #include <iostream>
+#include <utility>
+#include "CompactDoublyLinkedList.h"
 #include "DoublyLinkedList.h"
+#include "RawDoublyLinkedList.h"
 
 int main() {
 
@@ -33,6 +37,67 @@ int main() {
     assignedList = list;
     assignedList.printForward();
 
+    // splitAt / append / splice: mueven nodos entre listas sin copiarlos
+    list.pushBack(40);
+    DoublyLinkedList<int> rest = list.splitAt(2);
+    list.printForward();  // Head -> 10 <-> 99 <- Tail
+    rest.printForward();  // Head -> 30 <-> 40 <- Tail
+    DoublyLinkedList<int> extra;
+    extra.pushBack(1);
+    extra.pushBack(2);
+    rest.splice(1, extra);    // extra queda vacía
+    rest.printForward();  // Head -> 30 <-> 1 <-> 2 <-> 40 <- Tail
+    list.append(std::move(rest));
+    list.pushBack(50);        // tail apunta al último nodo movido
+    list.printForward();  // Head -> 10 <-> 99 <-> 30 <-> 1 <-> 2 <-> 40 <-> 50 <- Tail
+    list.printBackward(); // Tail -> 50 <-> 40 <-> 2 <-> 1 <-> 30 <-> 99 <-> 10 <- Head
+    std::cout << "Tamaños: " << list.getSize() << ", " << rest.getSize() << ", " << extra.getSize() << "\n"; // 7, 0, 0
+
+    // Iteradores: insert, erase y move_to_front en O(1) sobre una posición ya conocida
+    DoublyLinkedList<int>::iterator it = std::find(list.begin(), list.end(), 30);
+    list.insert(it, 25);
+    list.printForward();  // Head -> 10 <-> 99 <-> 25 <-> 30 <-> 1 <-> 2 <-> 40 <-> 50 <- Tail
+    list.move_to_front(it);   // it sigue apuntando a 30
+    list.printForward();  // Head -> 30 <-> 10 <-> 99 <-> 25 <-> 1 <-> 2 <-> 40 <-> 50 <- Tail
+    list.erase(it);
+    list.printForward();  // Head -> 10 <-> 99 <-> 25 <-> 1 <-> 2 <-> 40 <-> 50 <- Tail
+    std::cout << "Al revés:";
+    for (DoublyLinkedList<int>::reverse_iterator r = list.rbegin(); r != list.rend(); ++r) {
+        std::cout << " " << *r;
+    }
+    std::cout << "\n";   // 50 40 2 1 25 99 10
+
+    // RawDoublyLinkedList: misma interfaz con punteros crudos
+    RawDoublyLinkedList<int> raw;
+    raw.pushBack(1);
+    raw.pushBack(2);
+    raw.pushBack(3);
+    raw.printForward();   // Head -> 1 <-> 2 <-> 3 <- Tail
+    raw.printBackward();  // Tail -> 3 <-> 2 <-> 1 <- Head
+    raw.remove(2);
+    raw.printForward();   // Head -> 1 <-> 3 <- Tail
+
+    // CompactDoublyLinkedList: los nodos viven en un array y se enlazan por índices
+    CompactDoublyLinkedList<int> compact;
+    for (int i = 1; i <= 5; ++i) {
+        compact.pushBack(i * 10);
+    }
+    compact.remove(20);       // Su nodo pasa a la lista de libres...
+    compact.pushFront(5);     // ...y el siguiente elemento lo reutiliza
+    compact.insert(3, 35);
+    compact.printForward();   // Head -> 5 <-> 10 <-> 30 <-> 35 <-> 40 <-> 50 <- Tail
+    compact.compact();        // Mismo contenido, nodos en orden en el array
+    compact.printBackward();  // Tail -> 50 <-> 40 <-> 35 <-> 30 <-> 10 <-> 5 <- Head
+    std::cout << "Tamaño y capacidad: " << compact.getSize() << ", " << compact.getCapacity() << "\n"; // 6, 16
+
+    // clear() libera los nodos con un bucle: no desborda la pila con listas largas
+    DoublyLinkedList<int> big;
+    for (int i = 0; i < 1000000; ++i) {
+        big.pushBack(i);
+    }
+    std::size_t bigSize = big.getSize();
+    big.clear();
+    std::cout << "Tamaños: " << bigSize << ", " << big.getSize() << "\n"; // 1000000, 0
 
     return 0;
 }
\ No newline at end of file
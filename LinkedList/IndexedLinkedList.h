@@ -0,0 +1,425 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+/*
+    Lista enlazada simple con un índice hash de valor a nodo previo.
+
+    La lista mantiene el orden de inserción como LinkedList, pero además
+    guarda una tabla hash de direccionamiento abierto (sondeo lineal) en la
+    que cada elemento tiene una entrada con el nodo que lo precede. Con el
+    previo a mano, remove(value) desenlaza el nodo en O(1) de media en vez de
+    recorrer la lista desde head_, y contains(value) también es O(1).
+
+    Los valores son únicos: insertar uno que ya está no hace nada y devuelve
+    false. Por eso los iteradores y at() solo dan acceso de lectura: cambiar
+    un valor desde fuera dejaría su entrada de la tabla en el sitio equivocado.
+
+    Para que todo elemento tenga un previo, la lista empieza en un nodo
+    centinela (sentinel_) que no guarda ningún valor; el primer elemento es
+    sentinel_.next.
+*/
+
+template <typename T, typename Hash = std::hash<T>>
+class IndexedLinkedList {
+    struct Link;
+    struct Node;
+
+public:
+    // Iterador de solo lectura hacia delante
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : link_(nullptr) {}
+
+        reference operator*() const {
+            return static_cast<Node*>(link_)->data;
+        }
+
+        pointer operator->() const {
+            return &static_cast<Node*>(link_)->data;
+        }
+
+        const_iterator& operator++() {
+            link_ = link_->next;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            link_ = link_->next;
+            return previous;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) {
+            return a.link_ == b.link_;
+        }
+
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) {
+            return a.link_ != b.link_;
+        }
+
+    private:
+        friend class IndexedLinkedList;
+
+        Link* link_;   // nullptr es end()
+
+        explicit const_iterator(Link* link) : link_(link) {}
+    };
+
+    using iterator = const_iterator;
+
+    // Constructor por defecto
+    explicit IndexedLinkedList(const Hash& hash = Hash())
+        : tail_(&sentinel_), size_(0), slots_(nullptr), capacity_(0), shift_(64), hash_(hash) {
+        sentinel_.next = nullptr;
+        allocateSlots(kInitialCapacity);
+    }
+
+    // Constructor de copia
+    IndexedLinkedList(const IndexedLinkedList& other)
+        : tail_(&sentinel_), size_(0), slots_(nullptr), capacity_(0), shift_(64), hash_(other.hash_) {
+        sentinel_.next = nullptr;
+        allocateSlots(other.capacity_);
+        copy(other);
+    }
+
+    // Operador =
+    IndexedLinkedList& operator=(const IndexedLinkedList& other) {
+        if (this != &other) {
+            clear();
+            copy(other);
+        }
+
+        return *this;
+    }
+
+    // Destructor
+    ~IndexedLinkedList() {
+        clear();
+        delete[] slots_;
+    }
+
+    // Comprueba si está vacío
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Devuelve el número de elementos
+    std::size_t size() const {
+        return size_;
+    }
+
+    // Número de entradas de la tabla hash (ocupadas o no)
+    std::size_t indexCapacity() const {
+        return capacity_;
+    }
+
+    // Elimina todos los elementos
+    void clear() {
+        Link* current = sentinel_.next;
+        while (current != nullptr) {
+            Link* temp = current;
+            current = current->next;
+            delete static_cast<Node*>(temp);
+        }
+        sentinel_.next = nullptr;
+        tail_ = &sentinel_;
+        size_ = 0;
+
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots_[i].prev = nullptr;
+        }
+    }
+
+    // Inserta un elemento al principio. Devuelve false si ya estaba.
+    bool pushFront(const T& value) {
+        return linkAfter(&sentinel_, value);
+    }
+
+    // Inserta un elemento al final. Devuelve false si ya estaba.
+    bool pushBack(const T& value) {
+        return linkAfter(tail_, value);
+    }
+
+    // Inserta en un índice específico. Devuelve false si el valor ya estaba.
+    bool insert(std::size_t index, const T& value) {
+        if (index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        return linkAfter(linkAt(index), value);
+    }
+
+    // Comprueba si el valor está en la lista. O(1) de media.
+    bool contains(const T& value) const {
+        return findSlot(value, hash_(value)) != kNotFound;
+    }
+
+    // Elimina el valor si está. O(1) de media: la tabla da el nodo previo.
+    bool remove(const T& value) {
+        std::size_t slot = findSlot(value, hash_(value));
+        if (slot == kNotFound) {
+            return false;
+        }
+
+        unlinkAfter(slots_[slot].prev, slot);
+        return true;
+    }
+
+    // Elimina el elemento en una posición específica
+    void removeAt(std::size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        Link* prev = linkAt(index);
+        Node* node = static_cast<Node*>(prev->next);
+        unlinkAfter(prev, findSlot(node->data, hash_(node->data)));
+    }
+
+    // Accede a un elemento en la posición (solo lectura)
+    const T& at(std::size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        return static_cast<Node*>(linkAt(index)->next)->data;
+    }
+
+    const_iterator begin() const {
+        return const_iterator(sentinel_.next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator(sentinel_.next);
+    }
+
+    const_iterator cend() const {
+        return const_iterator(nullptr);
+    }
+
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty list]\n";
+            return;
+        }
+
+        Link* current = sentinel_.next;
+        std::cout << "Head -> ";
+        while (current != nullptr) {
+            std::cout << static_cast<Node*>(current)->data;
+            if (current->next != nullptr) {
+                std::cout << " -> ";
+            }
+            current = current->next;
+        }
+        std::cout << " -> nullptr\n";
+    }
+
+private:
+    // Enlace sin valor: es lo único que tiene el centinela
+    struct Link {
+        Link* next;
+    };
+
+    struct Node : Link {
+        T data;
+
+        explicit Node(const T& value) : Link{nullptr}, data(value) {}
+    };
+
+    // Entrada de la tabla: el nodo previo al del valor y el hash del valor,
+    // para descartar colisiones y redimensionar sin volver a calcularlo.
+    // prev == nullptr marca una entrada libre.
+    struct Slot {
+        Link* prev;
+        std::size_t hash;
+    };
+
+    static constexpr std::size_t kInitialCapacity = 16;
+    static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
+
+    Link sentinel_;
+    Link* tail_;          // Último nodo, o &sentinel_ si la lista está vacía
+    std::size_t size_;
+
+    Slot* slots_;
+    std::size_t capacity_;   // Potencia de dos
+    unsigned shift_;         // 64 - log2(capacity_), para el hash de Fibonacci
+    Hash hash_;
+
+    // std::hash de enteros suele ser la identidad: multiplicar por 2^64 / phi
+    // y quedarse con los bits altos reparte bien incluso claves consecutivas
+    // o múltiplos de una potencia de dos.
+    std::size_t home(std::size_t hash) const {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> shift_);
+    }
+
+    // Entrada del valor, o kNotFound
+    std::size_t findSlot(const T& value, std::size_t hash) const {
+        std::size_t mask = capacity_ - 1;
+        for (std::size_t i = home(hash);; i = (i + 1) & mask) {
+            const Slot& slot = slots_[i];
+            if (slot.prev == nullptr) {
+                return kNotFound;
+            }
+            if (slot.hash == hash && static_cast<Node*>(slot.prev->next)->data == value) {
+                return i;
+            }
+        }
+    }
+
+    // Entrada del nodo node: se compara por dirección, no por valor
+    std::size_t findSlotOf(const Node* node, std::size_t hash) const {
+        std::size_t mask = capacity_ - 1;
+        for (std::size_t i = home(hash);; i = (i + 1) & mask) {
+            if (slots_[i].hash == hash && slots_[i].prev->next == node) {
+                return i;
+            }
+        }
+    }
+
+    void placeSlot(Link* prev, std::size_t hash) {
+        std::size_t mask = capacity_ - 1;
+        std::size_t i = home(hash);
+        while (slots_[i].prev != nullptr) {
+            i = (i + 1) & mask;
+        }
+        slots_[i].prev = prev;
+        slots_[i].hash = hash;
+    }
+
+    // Libera la entrada i con borrado por desplazamiento hacia atrás: las
+    // entradas siguientes del mismo tramo que podrían estar más cerca de su
+    // posición ideal se adelantan, así no hacen falta marcas de borrado.
+    void eraseSlot(std::size_t i) {
+        std::size_t mask = capacity_ - 1;
+        std::size_t j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (slots_[j].prev == nullptr) {
+                break;
+            }
+            std::size_t k = home(slots_[j].hash);
+            // j puede ocupar el hueco i si su posición ideal k no está en (i, j]
+            bool between = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+            if (!between) {
+                slots_[i] = slots_[j];
+                i = j;
+            }
+        }
+        slots_[i].prev = nullptr;
+    }
+
+    void allocateSlots(std::size_t capacity) {
+        slots_ = new Slot[capacity];
+        capacity_ = capacity;
+        shift_ = 64;
+        for (std::size_t c = capacity; c > 1; c >>= 1) {
+            --shift_;
+        }
+        for (std::size_t i = 0; i < capacity; ++i) {
+            slots_[i].prev = nullptr;
+        }
+    }
+
+    // Dobla la tabla; las entradas se recolocan con el hash guardado
+    void grow() {
+        Slot* old = slots_;
+        std::size_t oldCapacity = capacity_;
+        allocateSlots(oldCapacity * 2);
+        for (std::size_t i = 0; i < oldCapacity; ++i) {
+            if (old[i].prev != nullptr) {
+                placeSlot(old[i].prev, old[i].hash);
+            }
+        }
+        delete[] old;
+    }
+
+    // Enlace previo a la posición index (el centinela para index 0)
+    Link* linkAt(std::size_t index) const {
+        if (index == size_) {
+            return tail_;
+        }
+
+        Link* current = const_cast<Link*>(&sentinel_);
+        for (std::size_t i = 0; i < index; ++i) {
+            current = current->next;
+        }
+        return current;
+    }
+
+    // Inserta value detrás de prev si no estaba ya en la lista
+    bool linkAfter(Link* prev, const T& value) {
+        std::size_t hash = hash_(value);
+        if (findSlot(value, hash) != kNotFound) {
+            return false;
+        }
+
+        // Carga máxima 3/4; prev es un nodo de la lista y no se mueve al crecer
+        if ((size_ + 1) * 4 > capacity_ * 3) {
+            grow();
+        }
+
+        // El que iba detrás de prev pasará a ir detrás del nodo nuevo. Su
+        // entrada se busca antes de reenlazar: se reconoce por prev->next.
+        Node* next = static_cast<Node*>(prev->next);
+        std::size_t nextSlot = next != nullptr ? findSlotOf(next, hash_(next->data)) : kNotFound;
+
+        Node* node = new Node(value);
+        node->next = next;
+        prev->next = node;
+        placeSlot(prev, hash);
+
+        if (next != nullptr) {
+            slots_[nextSlot].prev = node;
+        } else {
+            tail_ = node;
+        }
+
+        ++size_;
+        return true;
+    }
+
+    // Desenlaza el nodo que sigue a prev; slot es su entrada en la tabla
+    void unlinkAfter(Link* prev, std::size_t slot) {
+        Node* node = static_cast<Node*>(prev->next);
+        Node* next = static_cast<Node*>(node->next);
+
+        // El siguiente pasa a tener como previo a prev. Su entrada se busca
+        // antes de reenlazar (después la del nodo borrado también cumpliría
+        // prev->next == next) y se actualiza antes de liberar la del nodo,
+        // porque eraseSlot puede mover otras entradas.
+        std::size_t nextSlot = next != nullptr ? findSlotOf(next, hash_(next->data)) : kNotFound;
+        prev->next = next;
+        if (next != nullptr) {
+            slots_[nextSlot].prev = prev;
+        } else {
+            tail_ = prev;
+        }
+
+        eraseSlot(slot);
+        delete node;
+        --size_;
+    }
+
+    void copy(const IndexedLinkedList& other) {
+        for (const T& value : other) {
+            pushBack(value);
+        }
+    }
+};
@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+#include "IndexedLinkedList.h"
+#include "LinkedList.h"
+
+// BENCHMARK: IndexedLinkedList frente a LinkedList
+//
+// Uso: ./IndexedLinkedListBenchmark [exponente] [operaciones_lineales]
+// Con 10^exponente (10^6 por defecto) valores distintos de 64 bits, insertados
+// en orden, se mide:
+//  - "memoria": bytes pedidos al heap por elemento, contando cada new/delete
+//  - "contains": buscar un valor al azar que está en la lista
+//  - "remove": quitar los valores en orden aleatorio
+//  - "remove+pushBack": mover un valor al azar al final, como al renovar una
+//    sesión en una lista ordenada por caducidad
+// En LinkedList estas operaciones recorren la lista desde head_ (O(n)), así que
+// solo se hacen 'operaciones_lineales' (100 por defecto).
+// Antes se comprueba con operaciones al azar frente a un std::vector que las dos
+// listas dan el mismo contenido, también con un hash que colisiona casi siempre.
+
+// Todos los valores caen en 4 posiciones de la tabla: tramos de sondeo largos
+struct CollidingHash {
+    std::size_t operator()(int value) const {
+        return static_cast<std::size_t>(value % 4);
+    }
+};
+
+template <typename List>
+static void checkSame(const List& list, const std::vector<int>& expected) {
+    check(list.size() == expected.size(), "size() mismatch");
+    std::size_t i = 0;
+    for (int value : list) {
+        check(i < expected.size() && value == expected[i], "iteration mismatch");
+        ++i;
+    }
+    check(i == expected.size(), "iteration does not end at end()");
+}
+
+static bool inVector(const std::vector<int>& values, int value) {
+    return std::find(values.begin(), values.end(), value) != values.end();
+}
+
+template <typename Hash>
+static void verify(std::size_t steps) {
+    IndexedLinkedList<int, Hash> list;
+    std::vector<int> expected;
+    Random random(steps);
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        int value = static_cast<int>(random.next(300));
+        bool present = inVector(expected, value);
+        switch (random.next(7)) {
+            case 0:
+                check(list.pushFront(value) == !present, "pushFront return value is wrong");
+                if (!present) {
+                    expected.insert(expected.begin(), value);
+                }
+                break;
+            case 1:
+                check(list.pushBack(value) == !present, "pushBack return value is wrong");
+                if (!present) {
+                    expected.push_back(value);
+                }
+                break;
+            case 2: {
+                std::size_t index = random.next(expected.size() + 1);
+                check(list.insert(index, value) == !present, "insert return value is wrong");
+                if (!present) {
+                    expected.insert(expected.begin() + index, value);
+                }
+                break;
+            }
+            case 3:
+            case 4:
+                check(list.remove(value) == present, "remove return value is wrong");
+                if (present) {
+                    expected.erase(std::find(expected.begin(), expected.end(), value));
+                }
+                break;
+            case 5:
+                if (!expected.empty()) {
+                    std::size_t index = random.next(expected.size());
+                    list.removeAt(index);
+                    expected.erase(expected.begin() + index);
+                }
+                break;
+            default:
+                check(list.contains(value) == present, "contains is wrong");
+                if (!expected.empty()) {
+                    std::size_t index = random.next(expected.size());
+                    check(list.at(index) == expected[index], "at() is wrong");
+                }
+                break;
+        }
+
+        if (step % 97 == 0) {
+            checkSame(list, expected);
+            for (int v : expected) {
+                check(list.contains(v), "contains misses a value in the list");
+            }
+        }
+    }
+    checkSame(list, expected);
+
+    IndexedLinkedList<int, Hash> copyList(list);
+    checkSame(copyList, expected);
+    IndexedLinkedList<int, Hash> assigned;
+    assigned.pushBack(-1);
+    assigned = list;
+    checkSame(assigned, expected);
+    check(!assigned.contains(-1), "operator= keeps old values in the index");
+    list.clear();
+    checkSame(list, std::vector<int>());
+    check(expected.empty() || !list.contains(expected[0]), "clear() keeps values in the index");
+    check(copyList.pushBack(1000), "copy does not accept new values");
+}
+
+template <typename List>
+static void fill(List& list, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(static_cast<std::uint64_t>(i));
+    }
+}
+
+// LinkedList no tiene contains: se busca con std::find, lo que haría quien no tiene el índice
+static bool containsValue(const LinkedList<std::uint64_t>& list, std::uint64_t value) {
+    return std::find(list.cbegin(), list.cend(), value) != list.cend();
+}
+
+static bool containsValue(const IndexedLinkedList<std::uint64_t>& list, std::uint64_t value) {
+    return list.contains(value);
+}
+
+template <typename List>
+static void measureMemory(const std::string& name, std::size_t n) {
+    std::size_t before = liveBytes;
+    List* list = new List();
+    fill(*list, n);
+    std::cout << std::left << std::setw(28) << ("memoria " + name)
+              << std::right << std::setw(12) << n
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << static_cast<double>(liveBytes - before) / static_cast<double>(n) << " bytes/elem\n";
+    delete list;
+}
+
+template <typename List>
+static void timeOperations(const std::string& name, std::size_t n, std::size_t operations) {
+    Random random(n);
+
+    List list;
+    fill(list, n);
+    Stopwatch watch;
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < operations; ++i) {
+        found += containsValue(list, static_cast<std::uint64_t>(random.next(n))) ? 1 : 0;
+    }
+    printResult("contains " + name, operations, watch.elapsedNanoseconds() / operations);
+    check(found == operations, "contains misses a value");
+
+    watch.reset();
+    for (std::size_t i = 0; i < operations; ++i) {
+        std::uint64_t value = static_cast<std::uint64_t>(random.next(n));
+        list.remove(value);
+        list.pushBack(value);
+    }
+    printResult("remove+pushBack " + name, operations, watch.elapsedNanoseconds() / operations);
+    check(list.size() == n, "remove+pushBack changes the size");
+
+    // Valores en orden aleatorio; se quitan los primeros 'operations'
+    std::vector<std::uint64_t> order(list.begin(), list.end());
+    for (std::size_t i = order.size() - 1; i > 0; --i) {
+        std::swap(order[i], order[random.next(i + 1)]);
+    }
+    std::size_t removed = 0;
+    watch.reset();
+    for (std::size_t i = 0; i < operations; ++i) {
+        removed += list.remove(order[i]) ? 1 : 0;
+    }
+    printResult("remove " + name, operations, watch.elapsedNanoseconds() / operations);
+    check(removed == operations, "remove misses a value");
+    check(list.size() == n - operations, "size is wrong after remove");
+}
+
+int main(int argc, char** argv) {
+    std::size_t exp = argOrDefault(argc, argv, 1, 6);
+    std::size_t linearOperations = argOrDefault(argc, argv, 2, 100);
+    std::size_t n = powerOfTen(exp);
+
+    verify<std::hash<int>>(50000);
+    verify<CollidingHash>(20000);
+    std::cout << "Verificacion frente a std::vector: OK\n\n";
+
+    std::cout << "lista                                   n         ns/op\n";
+    measureMemory<LinkedList<std::uint64_t>>("LinkedList", n);
+    measureMemory<IndexedLinkedList<std::uint64_t>>("Indexed", n);
+    std::cout << "\n";
+    timeOperations<LinkedList<std::uint64_t>>("LinkedList", n, std::min(linearOperations, n));
+    timeOperations<IndexedLinkedList<std::uint64_t>>("Indexed", n, n);
+
+    return 0;
+}
@@ -1,18 +1,89 @@
 #pragma once
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <stdexcept>
 #include <iostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 template <typename T>
 class LinkedList {
+    struct Node;
+
 public:
+    // Iterador hacia delante. IsConst distingue iterator de const_iterator.
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator() : node_(nullptr) {}
+
+        // Un iterator se puede convertir en const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node_(other.node_) {}
+
+        reference operator*() const {
+            return node_->data;
+        }
+
+        pointer operator->() const {
+            return &node_->data;
+        }
+
+        BasicIterator& operator++() {
+            node_ = node_->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            node_ = node_->next;
+            return previous;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.node_ == b.node_;
+        }
+
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return a.node_ != b.node_;
+        }
+
+    private:
+        friend class LinkedList;
+        template <bool>
+        friend class BasicIterator;
+
+        Node* node_;   // nullptr es end()
+
+        explicit BasicIterator(Node* node) : node_(node) {}
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
     // Constructor por defecto
-    LinkedList() : head_{nullptr}, tail_{nullptr}, size_{0} {}
+    LinkedList() : head_{nullptr}, tail_{nullptr}, size_{0}, cursorIndex_{0}, cursorNode_{nullptr} {}
 
     // Constructor de copia
-    LinkedList(const LinkedList& other) : head_(nullptr), tail_(nullptr), size_ {0} {
+    LinkedList(const LinkedList& other)
+        : head_(nullptr), tail_(nullptr), size_ {0}, cursorIndex_(0), cursorNode_(nullptr) {
         copy(other);
     }
 
+    // Constructor de movimiento: se lleva los nodos de other sin copiarlos
+    LinkedList(LinkedList&& other) noexcept
+        : head_(nullptr), tail_(nullptr), size_(0), cursorIndex_(0), cursorNode_(nullptr) {
+        steal(other);
+    }
+
     // Operador =
     LinkedList& operator=(const LinkedList& other) {
         if (this != &other) {
@@ -23,6 +94,16 @@ public:
         return *this;
     }
 
+    // Asignación por movimiento
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+
+        return *this;
+    }
+
     // Destructor
     ~LinkedList() {
         clear();
@@ -47,6 +128,7 @@ public:
         }
         tail_ = nullptr;
         size_ = 0;
+        invalidateCursor();
     }
 
     // Inserta un elemento al principio
@@ -58,6 +140,11 @@ public:
             tail_ = newNode;
         }
 
+        // Todos los nodos avanzan una posición, también el del cursor
+        if (cursorNode_ != nullptr) {
+            ++cursorIndex_;
+        }
+
         ++size_;
     }
 
@@ -92,12 +179,9 @@ public:
             return;
         }
 
-        // Buscamos el nodo en posición index - 1 (el previo)
-        Node* prev = head_;
-        for (size_t i = 0; i < index - 1; ++i) {
-            prev = prev->next;
-            // Ahora prev apunta al nodo anterior del índice donde queremos insertar
-        }
+        // Buscamos el nodo en posición index - 1 (el previo). El cursor queda
+        // en él y sigue siendo válido: los nodos anteriores no se mueven.
+        Node* prev = nodeAt(index - 1);
 
         Node* newNode = new Node(value, prev->next);
         prev->next = newNode;
@@ -121,6 +205,7 @@ public:
                 tail_ = nullptr;
             }
 
+            invalidateCursor();
             return true;
         }
 
@@ -145,6 +230,7 @@ public:
 
         delete temp;
         --size_;
+        invalidateCursor();
         return true;
     }
 
@@ -155,6 +241,13 @@ public:
         }
 
         if (index == 0) {
+            // Si el cursor estaba en la cabeza desaparece; si no, retrocede una posición
+            if (cursorNode_ == head_) {
+                invalidateCursor();
+            } else if (cursorNode_ != nullptr) {
+                --cursorIndex_;
+            }
+
             Node* temp = head_;
             head_ = head_->next;
             delete temp;
@@ -167,16 +260,14 @@ public:
             return;
         }
 
-        Node* prev = head_;
-        for (size_t i = 0; i < index - 1; ++i) {
-            prev = prev->next;
-        }
+        // El cursor queda en prev, que no se mueve
+        Node* prev = nodeAt(index - 1);
 
         Node* temp = prev->next;
         prev->next = temp->next;
 
         if (temp == tail_) {
-            tail_ = temp;
+            tail_ = prev;
         }
 
         delete temp;
@@ -189,12 +280,241 @@ public:
             throw std::out_of_range("Index out of range");
         }
 
+        return nodeAt(index)->data;
+    }
+
+    iterator begin() {
+        return iterator(head_);
+    }
+
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head_);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator(head_);
+    }
+
+    const_iterator cend() const {
+        return const_iterator(nullptr);
+    }
+
+    // Inserta value justo después de position en O(1). Devuelve un iterador al nuevo elemento.
+    iterator insert_after(const_iterator position, const T& value) {
+        if (position.node_ == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+
+        Node* newNode = new Node(value, position.node_->next);
+        position.node_->next = newNode;
+
+        if (position.node_ == tail_) {
+            tail_ = newNode;
+        }
+
+        // No sabemos en qué índice está position: el cursor deja de ser fiable
+        invalidateCursor();
+        ++size_;
+        return iterator(newNode);
+    }
+
+    // Elimina el elemento que sigue a position en O(1). Devuelve un iterador al siguiente al borrado.
+    iterator erase_after(const_iterator position) {
+        if (position.node_ == nullptr || position.node_->next == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+
+        Node* temp = position.node_->next;
+        position.node_->next = temp->next;
+
+        if (temp == tail_) {
+            tail_ = position.node_;
+        }
+
+        delete temp;
+        --size_;
+        invalidateCursor();
+        return iterator(position.node_->next);
+    }
+
+    // Mueve todos los nodos de other al final de esta lista en O(1). other queda vacía.
+    void append(LinkedList&& other) {
+        splice(size_, other);
+    }
+
+    // Mueve todos los nodos de other a la posición index, sin copiarlos.
+    // O(1) al principio y al final; en otra posición hay que llegar al nodo
+    // previo (desde el cursor si se puede). other queda vacía.
+    void splice(std::size_t index, LinkedList& other) {
+        if (&other == this) {
+            throw std::invalid_argument("Cannot splice a list into itself");
+        }
+        if (index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (other.empty()) {
+            return;
+        }
+
+        if (empty()) {
+            head_ = other.head_;
+            tail_ = other.tail_;
+        } else if (index == 0) {
+            other.tail_->next = head_;
+            head_ = other.head_;
+            // Todos los nodos avanzan other.size_ posiciones, también el del cursor
+            if (cursorNode_ != nullptr) {
+                cursorIndex_ += other.size_;
+            }
+        } else if (index == size_) {
+            tail_->next = other.head_;
+            tail_ = other.tail_;
+        } else {
+            // El cursor queda en prev, que no se mueve
+            Node* prev = nodeAt(index - 1);
+            other.tail_->next = prev->next;
+            prev->next = other.head_;
+        }
+
+        size_ += other.size_;
+        other.release();
+    }
+
+    // Mueve todos los nodos de other justo detrás de position en O(1). other queda vacía.
+    void splice_after(const_iterator position, LinkedList& other) {
+        if (&other == this) {
+            throw std::invalid_argument("Cannot splice a list into itself");
+        }
+        if (position.node_ == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        if (other.empty()) {
+            return;
+        }
+
+        other.tail_->next = position.node_->next;
+        position.node_->next = other.head_;
+        if (position.node_ == tail_) {
+            tail_ = other.tail_;
+        }
+
+        // No sabemos en qué índice está position: el cursor deja de ser fiable
+        invalidateCursor();
+        size_ += other.size_;
+        other.release();
+    }
+
+    // Corta la lista en index: esta se queda con [0, index) y devuelve una
+    // lista nueva con [index, size()), sin copiar nodos. Cuesta llegar al
+    // nodo previo a index.
+    LinkedList splitAt(std::size_t index) {
+        if (index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        LinkedList rest;
+        if (index == size_) {
+            return rest;
+        }
+
+        if (index == 0) {
+            rest.steal(*this);
+            return rest;
+        }
+
+        // El cursor queda en prev, que se queda en esta lista
+        Node* prev = nodeAt(index - 1);
+        rest.head_ = prev->next;
+        rest.tail_ = tail_;
+        rest.size_ = size_ - index;
+
+        prev->next = nullptr;
+        tail_ = prev;
+        size_ = index;
+        return rest;
+    }
+
+    // Ordena la lista reenlazando los nodos existentes (merge sort de abajo
+    // arriba): O(n log n), estable y sin reservar memoria.
+    template <typename Compare = std::less<T>>
+    void sort(Compare compare = Compare()) {
+        if (size_ < 2) {
+            return;
+        }
+
+        head_ = sortChain(head_, compare);
+        relinkTail();
+    }
+
+    // Como sort, pero parte la lista en tramos que se ordenan en paralelo,
+    // uno por hilo, y luego se mezclan por parejas también en paralelo.
+    // threads = 0 usa un hilo por núcleo. Con listas pequeñas ordena en este hilo.
+    template <typename Compare = std::less<T>>
+    void parallelSort(std::size_t threads = 0, Compare compare = Compare()) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        std::size_t runs = size_ / kMinParallelRun;
+        if (runs > threads) {
+            runs = threads;
+        }
+        if (runs < 2) {
+            sort(compare);
+            return;
+        }
+
+        // Cortamos la lista en runs tramos de tamaño parecido terminados en nullptr
+        Node** heads = new Node*[runs];
         Node* current = head_;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
+        for (std::size_t r = 0; r < runs; ++r) {
+            heads[r] = current;
+            std::size_t length = size_ / runs + (r < size_ % runs ? 1 : 0);
+            for (std::size_t i = 1; i < length; ++i) {
+                current = current->next;
+            }
+            Node* next = current->next;
+            current->next = nullptr;
+            current = next;
+        }
+
+        // Cada tramo se ordena en su hilo; el primero, en este
+        std::thread* workers = new std::thread[runs];
+        for (std::size_t r = 1; r < runs; ++r) {
+            workers[r] = std::thread([heads, r, compare]() {
+                heads[r] = sortChain(heads[r], compare);
+            });
+        }
+        heads[0] = sortChain(heads[0], compare);
+        for (std::size_t r = 1; r < runs; ++r) {
+            workers[r].join();
+        }
+
+        // Mezclas por parejas: en cada ronda el tramo i absorbe al i + width
+        for (std::size_t width = 1; width < runs; width *= 2) {
+            for (std::size_t i = 2 * width; i + width < runs; i += 2 * width) {
+                workers[i] = std::thread([heads, i, width, compare]() {
+                    heads[i] = mergeChains(heads[i], heads[i + width], compare);
+                });
+            }
+            heads[0] = mergeChains(heads[0], heads[width], compare);
+            for (std::size_t i = 2 * width; i + width < runs; i += 2 * width) {
+                workers[i].join();
+            }
         }
 
-        return current->data;
+        head_ = heads[0];
+        delete[] workers;
+        delete[] heads;
+        relinkTail();
     }
 
     void print() const {
@@ -227,6 +547,123 @@ private:
     Node* tail_;
     std::size_t size_;
 
+    // Cursor: último nodo al que se llegó por índice. Si el siguiente índice
+    // pedido es igual o mayor, la búsqueda sigue desde aquí en lugar de desde
+    // head_, así que los bucles con índices crecientes son O(n) en total.
+    // Es mutable para poder moverlo también en accesos de solo lectura.
+    mutable std::size_t cursorIndex_;
+    mutable Node* cursorNode_;   // nullptr si no hay cursor válido
+
+    void invalidateCursor() const {
+        cursorNode_ = nullptr;
+        cursorIndex_ = 0;
+    }
+
+    // Nodo en la posición index (< size_), partiendo del cursor si está antes
+    Node* nodeAt(std::size_t index) const {
+        if (index == size_ - 1) {
+            return tail_;
+        }
+
+        Node* current = head_;
+        std::size_t position = 0;
+        if (cursorNode_ != nullptr && cursorIndex_ <= index) {
+            current = cursorNode_;
+            position = cursorIndex_;
+        }
+
+        for (; position < index; ++position) {
+            current = current->next;
+        }
+
+        cursorIndex_ = index;
+        cursorNode_ = current;
+        return current;
+    }
+
+    // Por debajo de este tamaño por hilo no compensa lanzar hilos
+    static constexpr std::size_t kMinParallelRun = 1 << 14;
+
+    // Mezcla dos cadenas ordenadas terminadas en nullptr. Ante empate va
+    // primero el nodo de a, que es lo que hace estable la ordenación.
+    template <typename Compare>
+    static Node* mergeChains(Node* a, Node* b, const Compare& compare) {
+        Node* head = nullptr;
+        Node** link = &head;
+        while (a != nullptr && b != nullptr) {
+            if (compare(b->data, a->data)) {
+                *link = b;
+                b = b->next;
+            } else {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+        *link = a != nullptr ? a : b;
+        return head;
+    }
+
+    // Merge sort de abajo arriba sobre una cadena terminada en nullptr.
+    // bins[i] es vacío o una cadena ordenada de 2^i nodos: cada nodo nuevo se
+    // mezcla con los bins ocupados como en una suma binaria con acarreo. Los
+    // bins siempre contienen nodos anteriores a los del acarreo, por eso van
+    // como primer argumento de mergeChains.
+    template <typename Compare>
+    static Node* sortChain(Node* chain, Compare compare) {
+        Node* bins[64] = {};
+        std::size_t used = 0;
+        while (chain != nullptr) {
+            Node* carry = chain;
+            chain = chain->next;
+            carry->next = nullptr;
+
+            std::size_t i = 0;
+            for (; bins[i] != nullptr; ++i) {
+                carry = mergeChains(bins[i], carry, compare);
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            if (i + 1 > used) {
+                used = i + 1;
+            }
+        }
+
+        Node* result = nullptr;
+        for (std::size_t i = 0; i < used; ++i) {
+            if (bins[i] != nullptr) {
+                result = mergeChains(bins[i], result, compare);
+            }
+        }
+        return result;
+    }
+
+    // Tras reenlazar los nodos: recoloca tail_ y descarta el cursor
+    void relinkTail() {
+        Node* current = head_;
+        while (current->next != nullptr) {
+            current = current->next;
+        }
+        tail_ = current;
+        invalidateCursor();
+    }
+
+    // Deja la lista vacía sin liberar los nodos, que ahora son de otra lista
+    void release() {
+        head_ = nullptr;
+        tail_ = nullptr;
+        size_ = 0;
+        invalidateCursor();
+    }
+
+    // Se queda con los nodos de other (esta lista tiene que estar vacía)
+    void steal(LinkedList& other) {
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+        other.release();
+    }
+
     void copy(const LinkedList& other) {
         head_ = nullptr;
         tail_ = nullptr;
@@ -0,0 +1,146 @@
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include "Benchmark.h"
+#include "LinkedList.h"
+#include "CircularLinkedList.h"
+
+// BENCHMARK: acceso por índice con cursor en LinkedList y CircularLinkedList
+//
+// Uso: ./LinkedListBenchmark [exponente_maximo] [exponente_maximo_aleatorio]
+// Para listas de 10^3 a 10^exponente_maximo (10^6 por defecto) se mide:
+//  - "at secuencial": sum += at(i) con i creciente; el cursor lo hace O(n)
+//  - "range-for" y "std::accumulate" (solo LinkedList): el mismo recorrido con
+//    iteradores, como referencia junto al recorrido por índice
+//  - "at aleatorio": n accesos at(i) con i al azar; cada uno vuelve a head_ si
+//    el índice es menor que el del cursor, así que sigue siendo O(n^2)
+//  - "insert secuencial": insert(2i + 1, v) intercala un elemento tras cada uno
+//  - "removeAt secuencial": removeAt(i + 1) con i creciente deshace el insert anterior
+// El patrón aleatorio solo se ejecuta hasta 10^exponente_maximo_aleatorio (10^4
+// por defecto); para tamaños mayores se extrapola desde el último medido (crece con n^2).
+
+static void printScan(const std::string& name, std::size_t n, double seconds, bool estimated = false) {
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(10) << n
+              << std::setw(16) << std::fixed << std::setprecision(3) << seconds * 1000.0
+              << (estimated ? "  (estimado)" : "") << "\n";
+}
+
+// Último tiempo medido del patrón aleatorio, para extrapolar a tamaños mayores
+struct RandomEstimate {
+    double seconds = 0.0;
+    std::size_t n = 0;
+};
+
+template <typename List>
+static void fill(List& list, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(static_cast<long long>(i));
+    }
+}
+
+// Recorridos con iteradores, que solo tiene LinkedList
+static void iteratorScans(const std::string& listName, const LinkedList<long long>& list, long long expected) {
+    Stopwatch watch;
+    long long sum = 0;
+    for (long long value : list) {
+        sum += value;
+    }
+    double seconds = watch.elapsedSeconds();
+    check(sum == expected, "range-for sum is wrong");
+    printScan(listName + " range-for", list.size(), seconds);
+
+    watch.reset();
+    sum = std::accumulate(list.cbegin(), list.cend(), 0LL);
+    seconds = watch.elapsedSeconds();
+    check(sum == expected, "std::accumulate sum is wrong");
+    printScan(listName + " std::accumulate", list.size(), seconds);
+    doNotOptimize(sum);
+}
+
+static void iteratorScans(const std::string&, const CircularLinkedList<long long>&, long long) {}
+
+template <typename List>
+static void runPatterns(const std::string& listName, std::size_t n, bool measureRandom, RandomEstimate& estimate) {
+    List list;
+    fill(list, n);
+    long long expected = static_cast<long long>(n) * static_cast<long long>(n - 1) / 2;
+
+    Stopwatch watch;
+    long long sum = 0;
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        sum += list.at(i);
+    }
+    double seconds = watch.elapsedSeconds();
+    check(sum == expected, "sequential at(i) sum is wrong");
+    printScan(listName + " at secuencial", n, seconds);
+    iteratorScans(listName, list, expected);
+
+    if (measureRandom) {
+        Random random(n);
+        long long expectedRandom = 0;
+        watch.reset();
+        sum = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t index = random.next(n);
+            sum += list.at(index);
+            expectedRandom += static_cast<long long>(index);
+        }
+        estimate.seconds = watch.elapsedSeconds();
+        estimate.n = n;
+        check(sum == expectedRandom, "random at(i) sum is wrong");
+        printScan(listName + " at aleatorio", n, estimate.seconds);
+    } else if (estimate.n > 0) {
+        double ratio = static_cast<double>(n) / static_cast<double>(estimate.n);
+        printScan(listName + " at aleatorio", n, estimate.seconds * ratio * ratio, true);
+    }
+
+    // Tras cada elemento original se intercala un -1: la lista pasa a tener 2n elementos
+    watch.reset();
+    for (std::size_t i = 0; i < n; ++i) {
+        list.insert(2 * i + 1, -1);
+    }
+    seconds = watch.elapsedSeconds();
+    check(list.size() == 2 * n, "size after sequential insert is wrong");
+    printScan(listName + " insert secuencial", n, seconds);
+
+    // removeAt(i) con i creciente: en el paso i la lista es [0, .., i-1, -1, i, -1, ...]
+    // y se borra el -1 que sigue a los i originales ya recorridos
+    watch.reset();
+    for (std::size_t i = 0; i < n; ++i) {
+        list.removeAt(i + 1);
+    }
+    seconds = watch.elapsedSeconds();
+    check(list.size() == n, "size after sequential removeAt is wrong");
+    printScan(listName + " removeAt secuencial", n, seconds);
+
+    sum = 0;
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        check(list.at(i) == static_cast<long long>(i), "list content is wrong after insert/removeAt");
+        sum += list.at(i);
+    }
+    check(sum == expected, "sum after insert/removeAt is wrong");
+    doNotOptimize(sum);
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 6);
+    std::size_t maxRandomExp = argOrDefault(argc, argv, 2, 4);
+
+    std::cout << "patron                                         n     tiempo (ms)\n";
+
+    RandomEstimate linearEstimate;
+    RandomEstimate circularEstimate;
+    for (std::size_t exp = 3; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        bool measureRandom = exp <= maxRandomExp;
+
+        runPatterns<LinkedList<long long>>("LinkedList", n, measureRandom, linearEstimate);
+        runPatterns<CircularLinkedList<long long>>("CircularLinkedList", n, measureRandom, circularEstimate);
+
+        std::cout << "\n";
+    }
+
+    return 0;
+}
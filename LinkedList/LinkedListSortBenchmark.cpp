@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "LinkedList.h"
+
+// BENCHMARK: ordenar una LinkedList
+//
+// Uso: ./LinkedListSortBenchmark [exponente_maximo] [hilos_maximos]
+// Para listas de 10^4 a 10^exponente_maximo (10^6 por defecto) de enteros al azar,
+// con los nodos desordenados en memoria, se mide:
+//  - "vector + std::sort": copiar a un std::vector, ordenarlo y reconstruir la
+//    lista con pushBack (duplica la memoria y vuelve a reservar n nodos)
+//  - "sort()": merge sort de abajo arriba que reenlaza los nodos existentes
+//  - "parallelSort(h)": tramos ordenados en h hilos y mezclados por parejas,
+//    con h = 2, 4, ... hasta hilos_maximos (por defecto el doble de núcleos, mínimo 4)
+// Antes se comprueba que sort y parallelSort ordenan, son estables y dejan
+// size() y tail_ bien (un pushBack posterior tiene que quedar al final).
+
+// Clave con muchas repeticiones y posición original, para comprobar la estabilidad
+struct Record {
+    int key;
+    int position;
+};
+
+static bool byKey(const Record& a, const Record& b) {
+    return a.key < b.key;
+}
+
+static void verify(std::size_t n, std::size_t threads) {
+    LinkedList<Record> list;
+    Random random(n + threads);
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(Record{static_cast<int>(random.nextRaw() % 100), static_cast<int>(i)});
+    }
+
+    if (threads == 0) {
+        list.sort(byKey);
+    } else {
+        list.parallelSort(threads, byKey);
+    }
+
+    check(list.size() == n, "size() changed after sorting");
+    list.pushBack(Record{100, static_cast<int>(n)});
+
+    std::size_t count = 0;
+    const Record* previous = nullptr;
+    for (const Record& record : list) {
+        if (previous != nullptr) {
+            check(previous->key <= record.key, "list is not sorted");
+            check(previous->key < record.key || previous->position < record.position, "sort is not stable");
+        }
+        previous = &record;
+        ++count;
+    }
+    check(count == n + 1, "tail_ is wrong after sorting");
+    check(previous->position == static_cast<int>(n), "pushBack after sorting is not at the end");
+}
+
+// Rellena la lista con valores al azar y con los nodos desordenados en memoria,
+// como en una lista que lleva tiempo en uso: se reservan y liberan en orden
+// aleatorio n bloques del tamaño de un nodo, y el allocator (al menos el de
+// glibc) los reutiliza en el orden en que se liberaron. Así todas las
+// variantes parten de la misma disposición, sin depender de cómo dejó el
+// heap la anterior.
+static void fill(LinkedList<long long>& list, std::size_t n) {
+    Random random(n);
+    std::vector<void*> blocks(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        blocks[i] = ::operator new(2 * sizeof(long long));
+    }
+    for (std::size_t i = n - 1; i > 0; --i) {
+        std::swap(blocks[i], blocks[random.nextRaw() % (i + 1)]);
+    }
+    for (void* block : blocks) {
+        ::operator delete(block);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(static_cast<long long>(random.nextRaw() % 1000000000));
+    }
+}
+
+// Suma ponderada por posición: distingue dos listas ordenadas de forma distinta
+static long long checksum(const LinkedList<long long>& list) {
+    long long sum = 0;
+    long long position = 0;
+    for (long long value : list) {
+        sum += value * (position % 13 + 1);
+        ++position;
+    }
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    std::size_t cores = std::thread::hardware_concurrency();
+    std::size_t defaultThreads = 2 * cores > 4 ? 2 * cores : 4;
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 6);
+    std::size_t maxThreads = argOrDefault(argc, argv, 2, defaultThreads);
+
+    for (std::size_t n : {0, 1, 2, 1000, 100000}) {
+        verify(n, 0);
+        verify(n, 2);
+        verify(n, 3);
+        verify(n, 8);
+    }
+    std::cout << "Verificacion de orden, estabilidad y tail_: OK\n\n";
+
+    std::cout << "ordenacion                             n         ns/op\n";
+    for (std::size_t exp = 4; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        std::string suffix = " 10^" + std::to_string(exp);
+
+        LinkedList<long long> list;
+        fill(list, n);
+        Stopwatch watch;
+        std::vector<long long> values(list.begin(), list.end());
+        std::sort(values.begin(), values.end());
+        list.clear();
+        for (long long value : values) {
+            list.pushBack(value);
+        }
+        printResult("vector + std::sort" + suffix, n, watch.elapsedNanoseconds() / n);
+        long long expected = checksum(list);
+
+        list.clear();
+        fill(list, n);
+        watch.reset();
+        list.sort();
+        printResult("sort()" + suffix, n, watch.elapsedNanoseconds() / n);
+        check(checksum(list) == expected, "sort() disagrees with std::sort");
+
+        for (std::size_t threads = 2; threads <= maxThreads; threads *= 2) {
+            list.clear();
+            fill(list, n);
+            watch.reset();
+            list.parallelSort(threads);
+            printResult("parallelSort(" + std::to_string(threads) + ")" + suffix, n, watch.elapsedNanoseconds() / n);
+            check(checksum(list) == expected, "parallelSort() disagrees with std::sort");
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
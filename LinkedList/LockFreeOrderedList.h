@@ -0,0 +1,232 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "EpochReclamation.h"
+
+/*
+    Conjunto ordenado concurrente sin bloqueos (lista de Harris).
+
+    Es una lista enlazada simple ordenada por Compare, con un nodo centinela al
+    principio y nullptr al final. Cada enlace next es un puntero atómico cuyo
+    bit bajo es la "marca" de borrado del nodo que lo contiene:
+
+      1. remove marca el next del nodo (borrado lógico). A partir de ese
+         momento el valor ya no está en el conjunto y nadie puede enlazar nada
+         detrás del nodo, porque el CAS sobre su next fallaría.
+      2. Después se desenlaza con un CAS sobre el next del previo (borrado
+         físico). Si ese CAS falla, cualquier búsqueda posterior que se
+         encuentre el nodo marcado lo desenlaza por él.
+
+    El hilo que consigue desenlazar el nodo lo retira al EpochDomain, que lo
+    libera cuando ningún hilo puede seguir recorriéndolo. Eso permite además
+    recorrer la lista sin CAS: contains solo lee enlaces y nunca reintenta.
+*/
+
+template <typename T, typename Compare = std::less<T>>
+class LockFreeOrderedList {
+public:
+    // Constructor por defecto: la lista vacía contiene solo el centinela
+    explicit LockFreeOrderedList(const Compare& compare = Compare())
+        : compare_(compare) {
+        head_.next.store(0, std::memory_order_relaxed);
+    }
+
+    // Una lista compartida entre hilos no se copia
+    LockFreeOrderedList(const LockFreeOrderedList&) = delete;
+    LockFreeOrderedList& operator=(const LockFreeOrderedList&) = delete;
+
+    // Destructor: ningún otro hilo puede estar usando la lista. Los nodos
+    // marcados que siguen enlazados también son de la lista.
+    ~LockFreeOrderedList() {
+        Link* current = pointer(head_.next.load(std::memory_order_relaxed));
+        while (current != nullptr) {
+            Link* aux = current;
+            current = pointer(current->next.load(std::memory_order_relaxed));
+            delete static_cast<Node*>(aux);
+        }
+    }
+
+    // Inserta el valor en su posición. Devuelve false si ya estaba.
+    bool insert(const T& value) {
+        EpochGuard guard;
+        Node* node = nullptr;
+
+        while (true) {
+            Window window = find(value);
+            if (window.current != nullptr && equal(window.current->data, value)) {
+                delete node;   // Nunca llegó a publicarse
+                return false;
+            }
+
+            if (node == nullptr) {
+                node = new Node(value);
+            }
+            node->next.store(address(window.current), std::memory_order_relaxed);
+
+            std::uintptr_t expected = address(window.current);
+            if (window.previous->next.compare_exchange_strong(expected, address(node),
+                                                              std::memory_order_release,
+                                                              std::memory_order_relaxed)) {
+                return true;
+            }
+            // El previo cambió o fue marcado: se vuelve a buscar la posición
+        }
+    }
+
+    // Elimina el valor. Devuelve false si no estaba.
+    bool remove(const T& value) {
+        EpochGuard guard;
+
+        while (true) {
+            Window window = find(value);
+            if (window.current == nullptr || !equal(window.current->data, value)) {
+                return false;
+            }
+
+            // Borrado lógico: marcar el next del nodo. Si otro hilo lo marcó
+            // antes, ese remove es el que cuenta y find lo desenlazará.
+            std::uintptr_t next = window.current->next.load(std::memory_order_acquire);
+            if (isMarked(next)) {
+                continue;
+            }
+            if (!window.current->next.compare_exchange_strong(next, next | kMark,
+                                                              std::memory_order_acq_rel,
+                                                              std::memory_order_relaxed)) {
+                continue;
+            }
+
+            // Borrado físico. Si falla, find ya se encarga de desenlazarlo.
+            std::uintptr_t expected = address(window.current);
+            if (window.previous->next.compare_exchange_strong(expected, next,
+                                                              std::memory_order_acq_rel,
+                                                              std::memory_order_relaxed)) {
+                EpochDomain::instance().retire(window.current);
+            } else {
+                find(value);
+            }
+            return true;
+        }
+    }
+
+    // Comprueba si el valor está. Sin espera: recorre la lista una vez, sin
+    // CAS ni reintentos, y un nodo marcado cuenta como ausente.
+    bool contains(const T& value) const {
+        EpochGuard guard;
+
+        Link* current = pointer(head_.next.load(std::memory_order_acquire));
+        while (current != nullptr && compare_(static_cast<Node*>(current)->data, value)) {
+            current = pointer(current->next.load(std::memory_order_acquire));
+        }
+
+        return current != nullptr && equal(static_cast<Node*>(current)->data, value) &&
+               !isMarked(current->next.load(std::memory_order_acquire));
+    }
+
+    // Resultado instantáneo: otro hilo puede modificar la lista justo después
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // Cuenta los nodos no marcados. O(n) y, con otros hilos modificando la
+    // lista, solo aproximado.
+    std::size_t size() const {
+        EpochGuard guard;
+        std::size_t count = 0;
+
+        Link* current = pointer(head_.next.load(std::memory_order_acquire));
+        while (current != nullptr) {
+            std::uintptr_t next = current->next.load(std::memory_order_acquire);
+            if (!isMarked(next)) {
+                ++count;
+            }
+            current = pointer(next);
+        }
+        return count;
+    }
+
+private:
+    static constexpr std::uintptr_t kMark = 1;
+
+    // El centinela solo tiene enlace; los nodos son enlace + valor. El enlace
+    // es la dirección del siguiente con la marca en el bit bajo (los nodos
+    // están alineados al menos a 2 bytes).
+    struct Link {
+        std::atomic<std::uintptr_t> next{0};
+    };
+
+    struct Node : Link {
+        T data;
+
+        explicit Node(const T& value) : data(value) {}
+    };
+
+    // Resultado de find: previous < value <= current, los dos sin marcar
+    // en el momento de la búsqueda
+    struct Window {
+        Link* previous;
+        Node* current;
+    };
+
+    alignas(64) Link head_;
+    Compare compare_;
+
+    static bool isMarked(std::uintptr_t link) {
+        return (link & kMark) != 0;
+    }
+
+    static Link* pointer(std::uintptr_t link) {
+        return reinterpret_cast<Link*>(link & ~kMark);
+    }
+
+    static std::uintptr_t address(Link* link) {
+        return reinterpret_cast<std::uintptr_t>(link);
+    }
+
+    bool equal(const T& a, const T& b) const {
+        return !compare_(a, b) && !compare_(b, a);
+    }
+
+    // Busca el primer nodo no menor que value y su previo. Por el camino
+    // desenlaza los nodos marcados que encuentra y retira los que consigue
+    // desenlazar. Hay que llamarla dentro de un EpochGuard.
+    Window find(const T& value) {
+        while (true) {
+            Link* previous = &head_;
+            Link* current = pointer(previous->next.load(std::memory_order_acquire));
+            bool restart = false;
+
+            while (current != nullptr) {
+                std::uintptr_t next = current->next.load(std::memory_order_acquire);
+
+                if (isMarked(next)) {
+                    // current está borrado lógicamente: se salta con un CAS en el previo
+                    std::uintptr_t expected = address(current);
+                    if (!previous->next.compare_exchange_strong(expected, next & ~kMark,
+                                                                std::memory_order_acq_rel,
+                                                                std::memory_order_relaxed)) {
+                        // El previo cambió o también fue marcado: empezar de nuevo
+                        restart = true;
+                        break;
+                    }
+                    EpochDomain::instance().retire(static_cast<Node*>(current));
+                    current = pointer(next);
+                    continue;
+                }
+
+                if (!compare_(static_cast<Node*>(current)->data, value)) {
+                    return Window{previous, static_cast<Node*>(current)};
+                }
+
+                previous = current;
+                current = pointer(next);
+            }
+
+            if (!restart) {
+                return Window{previous, nullptr};
+            }
+        }
+    }
+};
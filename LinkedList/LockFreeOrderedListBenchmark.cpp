@@ -0,0 +1,220 @@
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "LinkedList.h"
+#include "LockFreeOrderedList.h"
+
+// BENCHMARK: LockFreeOrderedList (Harris + EBR) frente a una LinkedList ordenada con un mutex
+//
+// Uso: ./LockFreeOrderedListBenchmark [claves] [operaciones_totales] [hilos_maximos]
+// 1. Prueba de estrés: 8 hilos hacen insert/remove/contains al azar. Cada hilo
+//    es el único que toca sus claves pares y comprueba que cada resultado es el
+//    que tocaba; las claves impares las comparten todos y al final se comprueba
+//    que cada una está si y solo si hubo un insert con éxito más que remove.
+// 2. Lecturas mayoritarias: conjunto de 'claves' (1000 por defecto) posibles,
+//    lleno a la mitad; cada operación es un contains (90%), insert (5%) o
+//    remove (5%) de una clave al azar. Se mide el rendimiento agregado con
+//    1, 2, 4 ... hilos_maximos (16 por defecto).
+
+// LinkedList ordenada protegida por un único mutex global (situación de partida)
+class MutexOrderedList {
+public:
+    bool insert(long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        LinkedList<long long>::const_iterator previous = findPrevious(value);
+        LinkedList<long long>::const_iterator current = next(previous);
+        if (current != list_.cend() && *current == value) {
+            return false;
+        }
+        if (previous == list_.cend()) {
+            list_.pushFront(value);
+        } else {
+            list_.insert_after(previous, value);
+        }
+        return true;
+    }
+
+    bool remove(long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        LinkedList<long long>::const_iterator previous = findPrevious(value);
+        LinkedList<long long>::const_iterator current = next(previous);
+        if (current == list_.cend() || *current != value) {
+            return false;
+        }
+        if (previous == list_.cend()) {
+            list_.removeAt(0);
+        } else {
+            list_.erase_after(previous);
+        }
+        return true;
+    }
+
+    bool contains(long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        LinkedList<long long>::const_iterator current = next(findPrevious(value));
+        return current != list_.cend() && *current == value;
+    }
+
+private:
+    std::mutex mutex_;
+    LinkedList<long long> list_;
+
+    // Último elemento menor que value, o cend() si no hay ninguno
+    LinkedList<long long>::const_iterator findPrevious(long long value) const {
+        LinkedList<long long>::const_iterator previous = list_.cend();
+        for (LinkedList<long long>::const_iterator it = list_.cbegin(); it != list_.cend() && *it < value; ++it) {
+            previous = it;
+        }
+        return previous;
+    }
+
+    LinkedList<long long>::const_iterator next(LinkedList<long long>::const_iterator it) const {
+        if (it == list_.cend()) {
+            return list_.cbegin();
+        }
+        return ++it;
+    }
+};
+
+static void stressTest(std::size_t threads, std::size_t keysPerThread, std::size_t steps) {
+    LockFreeOrderedList<long long> list;
+    std::size_t sharedKeys = threads * keysPerThread;
+    std::vector<std::atomic<long long>> balance(sharedKeys);
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> workers;
+
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            Random random(t + 1);
+            std::vector<bool> owned(keysPerThread, false);
+
+            for (std::size_t step = 0; step < steps; ++step) {
+                bool shared = random.next(2) == 0;
+                std::size_t operation = random.next(3);
+
+                if (shared) {
+                    std::size_t i = random.next(sharedKeys);
+                    long long key = static_cast<long long>(2 * i + 1);
+                    if (operation == 0) {
+                        if (list.insert(key)) {
+                            balance[i].fetch_add(1, std::memory_order_relaxed);
+                        }
+                    } else if (operation == 1) {
+                        if (list.remove(key)) {
+                            balance[i].fetch_sub(1, std::memory_order_relaxed);
+                        }
+                    } else {
+                        list.contains(key);
+                    }
+                    continue;
+                }
+
+                // Clave propia: 2 * (t + threads * k), par, solo la toca este hilo
+                std::size_t k = random.next(keysPerThread);
+                long long key = static_cast<long long>(2 * (t + threads * k));
+                bool ok;
+                if (operation == 0) {
+                    ok = list.insert(key) == !owned[k];
+                    owned[k] = true;
+                } else if (operation == 1) {
+                    ok = list.remove(key) == owned[k];
+                    owned[k] = false;
+                } else {
+                    ok = list.contains(key) == owned[k];
+                }
+                if (!ok) {
+                    failed.store(true);
+                }
+            }
+
+            for (std::size_t k = 0; k < keysPerThread; ++k) {
+                long long key = static_cast<long long>(2 * (t + threads * k));
+                if (list.contains(key) != owned[k]) {
+                    failed.store(true);
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    check(!failed.load(), "an operation on a thread-owned key returned the wrong result");
+
+    for (std::size_t i = 0; i < sharedKeys; ++i) {
+        long long net = balance[i].load();
+        check(net == 0 || net == 1, "a shared key was inserted or removed twice");
+        check(list.contains(static_cast<long long>(2 * i + 1)) == (net == 1), "a shared key has the wrong state");
+    }
+}
+
+template <typename Set>
+static double readHeavy(std::size_t threads, std::size_t keys, std::size_t totalOperations) {
+    Set set;
+    Random prefill(keys);
+    for (std::size_t i = 0; i < keys / 2; ++i) {
+        set.insert(static_cast<long long>(prefill.next(keys)));
+    }
+
+    std::size_t perThread = totalOperations / threads;
+    std::vector<std::size_t> hits(threads, 0);
+    std::vector<std::thread> workers;
+
+    Stopwatch watch;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            Random random(t + 1);
+            std::size_t found = 0;
+            for (std::size_t i = 0; i < perThread; ++i) {
+                long long key = static_cast<long long>(random.next(keys));
+                std::size_t operation = random.next(100);
+                if (operation < 90) {
+                    found += set.contains(key) ? 1 : 0;
+                } else if (operation < 95) {
+                    set.insert(key);
+                } else {
+                    set.remove(key);
+                }
+            }
+            hits[t] = found;
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = watch.elapsedSeconds();
+
+    std::size_t found = 0;
+    for (std::size_t hit : hits) {
+        found += hit;
+    }
+    doNotOptimize(found);
+
+    return static_cast<double>(perThread * threads) / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    std::size_t keys = argOrDefault(argc, argv, 1, 1000);
+    std::size_t totalOperations = argOrDefault(argc, argv, 2, 2000000);
+    std::size_t maxThreads = argOrDefault(argc, argv, 3, 16);
+
+    stressTest(8, 64, 200000);
+    std::cout << "Prueba de estres con 8 hilos: OK\n\n";
+
+    std::cout << "Lecturas mayoritarias (90% contains), " << keys << " claves\n";
+    std::cout << "hilos   MutexOrderedList   LockFreeOrderedList   (Mops/s)\n";
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        double mutexRate = readHeavy<MutexOrderedList>(threads, keys, totalOperations);
+        double lockFreeRate = readHeavy<LockFreeOrderedList<long long>>(threads, keys, totalOperations);
+
+        std::cout << std::setw(5) << threads
+                  << std::setw(19) << std::fixed << std::setprecision(2) << mutexRate
+                  << std::setw(22) << lockFreeRate << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.h"
+#include "LinkedList.h"
+#include "CircularLinkedList.h"
+#include "DoublyLinkedList.h"
+#include "RawDoublyLinkedList.h"
+
+// BENCHMARK: juntar listas parciales con un bucle de pushBack frente a append
+//
+// Uso: ./SpliceBenchmark [exponente_maximo] [particiones]
+// Simula juntar los resultados de 'particiones' (16 por defecto) listas parciales
+// en una sola, con 10^4 a 10^exponente_maximo (10^6 por defecto) elementos en total:
+//  - "pushBack": se vacía cada parcial con at(0) + removeAt(0) y se copia con
+//    pushBack, una reserva y una liberación por elemento
+//  - "append": append(std::move(parcial)) reenlaza la lista entera en O(1)
+// Se mide en LinkedList, CircularLinkedList, DoublyLinkedList y
+// RawDoublyLinkedList: el bucle en ns por elemento y append en ns por lista parcial.
+// Antes se comprueba con operaciones al azar frente a un std::vector que splice,
+// append y splitAt dejan bien el contenido, el tamaño y la cola de las listas.
+
+// Las listas dobles llaman getSize() a lo que las otras llaman size()
+template <typename List>
+static std::size_t sizeOf(List& list) {
+    return list.size();
+}
+
+template <typename T>
+static std::size_t sizeOf(DoublyLinkedList<T>& list) {
+    return list.getSize();
+}
+
+template <typename T>
+static std::size_t sizeOf(RawDoublyLinkedList<T>& list) {
+    return list.getSize();
+}
+
+// Compara contenido y tamaño, y comprueba la cola: un pushBack tiene que quedar al final
+template <typename List>
+static void checkSame(List& list, std::vector<int>& expected) {
+    check(sizeOf(list) == expected.size(), "size is wrong");
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        check(list.at(i) == expected[i], "content is wrong");
+    }
+
+    list.pushBack(-1);
+    expected.push_back(-1);
+    check(sizeOf(list) == expected.size(), "size is wrong after pushBack");
+    check(list.at(expected.size() - 1) == -1, "tail is wrong: pushBack is not at the end");
+}
+
+template <typename List>
+static void verify(std::size_t steps) {
+    List first;
+    List second;
+    std::vector<int> expectedFirst;
+    std::vector<int> expectedSecond;
+    Random random(steps);
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        int value = static_cast<int>(random.next(1000));
+        switch (random.next(5)) {
+            case 0:
+                first.pushBack(value);
+                expectedFirst.push_back(value);
+                break;
+            case 1:
+                second.pushFront(value);
+                expectedSecond.insert(expectedSecond.begin(), value);
+                break;
+            case 2:
+                first.append(std::move(second));
+                expectedFirst.insert(expectedFirst.end(), expectedSecond.begin(), expectedSecond.end());
+                expectedSecond.clear();
+                break;
+            case 3: {
+                std::size_t index = random.next(expectedFirst.size() + 1);
+                first.splice(index, second);
+                expectedFirst.insert(expectedFirst.begin() + index, expectedSecond.begin(), expectedSecond.end());
+                expectedSecond.clear();
+                break;
+            }
+            default: {
+                std::size_t index = random.next(expectedFirst.size() + 1);
+                second = first.splitAt(index);
+                expectedSecond.assign(expectedFirst.begin() + index, expectedFirst.end());
+                expectedFirst.resize(index);
+                break;
+            }
+        }
+
+        checkSame(first, expectedFirst);
+        checkSame(second, expectedSecond);
+
+        // Mantenemos las listas pequeñas: at() de las listas dobles no tiene cursor
+        if (expectedFirst.size() > 200) {
+            first = first.splitAt(150);
+            expectedFirst.erase(expectedFirst.begin(), expectedFirst.begin() + 150);
+        }
+    }
+
+    bool thrown = false;
+    try {
+        first.splice(0, first);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    check(thrown, "splicing a list into itself does not throw");
+}
+
+template <typename List>
+static void fillShards(List* shards, std::size_t count, std::size_t perShard) {
+    for (std::size_t s = 0; s < count; ++s) {
+        for (std::size_t i = 0; i < perShard; ++i) {
+            shards[s].pushBack(static_cast<int>(s * perShard + i));
+        }
+    }
+}
+
+template <typename List>
+static void timeMerge(const std::string& listName, std::size_t n, std::size_t count) {
+    std::size_t perShard = n / count;
+    std::size_t total = perShard * count;
+    List* shards = new List[count];
+
+    fillShards(shards, count, perShard);
+    List merged;
+    Stopwatch watch;
+    for (std::size_t s = 0; s < count; ++s) {
+        while (!shards[s].empty()) {
+            merged.pushBack(shards[s].at(0));
+            shards[s].removeAt(0);
+        }
+    }
+    printResult(listName + " pushBack", total, watch.elapsedNanoseconds() / total);
+    check(sizeOf(merged) == total, "pushBack merge size is wrong");
+
+    fillShards(shards, count, perShard);
+    List appended;
+    watch.reset();
+    for (std::size_t s = 0; s < count; ++s) {
+        appended.append(std::move(shards[s]));
+    }
+    printResult(listName + " append", count, watch.elapsedNanoseconds() / count);
+    check(sizeOf(appended) == total, "append merge size is wrong");
+    check(appended.at(total - 1) == static_cast<int>(total - 1), "tail is wrong after append");
+    for (std::size_t s = 0; s < count; ++s) {
+        check(shards[s].empty(), "append does not empty the source list");
+    }
+
+    delete[] shards;
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 6);
+    std::size_t count = argOrDefault(argc, argv, 2, 16);
+
+    verify<LinkedList<int>>(20000);
+    verify<CircularLinkedList<int>>(20000);
+    verify<DoublyLinkedList<int>>(20000);
+    verify<RawDoublyLinkedList<int>>(20000);
+    std::cout << "Verificacion de splice, append y splitAt: OK\n\n";
+
+    std::cout << "Juntar " << count << " listas parciales\n";
+    std::cout << "metodo                                 n         ns/op\n";
+    for (std::size_t exp = 4; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        timeMerge<LinkedList<int>>("LinkedList", n, count);
+        timeMerge<CircularLinkedList<int>>("CircularLinkedList", n, count);
+        timeMerge<DoublyLinkedList<int>>("DoublyLinkedList", n, count);
+        timeMerge<RawDoublyLinkedList<int>>("RawDoublyLinkedList", n, count);
+        std::cout << "\n";
+    }
+
+    return 0;
+}
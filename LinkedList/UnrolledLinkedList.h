@@ -0,0 +1,480 @@
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+    Lista enlazada "desenrollada" (unrolled linked list).
+
+    Cada nodo guarda un pequeño array de hasta Capacity elementos en lugar de
+    uno solo. Por defecto Capacity se elige para que el nodo entero (enlace,
+    contador y array) ocupe dos líneas de caché de 64 bytes: recorrer la
+    lista toca un nodo cada Capacity elementos en vez de uno por elemento, y
+    dentro del nodo los datos son contiguos.
+
+    Invariante: todos los nodos salvo el último tienen al menos Capacity / 2
+    elementos. Insertar en un nodo lleno lo parte en dos mitades; borrar de
+    un nodo que baja de la mitad le pasa elementos del siguiente o lo fusiona
+    con él. Igual que LinkedList, recuerda el último nodo al que se llegó por
+    índice para que los bucles con índices crecientes no empiecen cada vez
+    desde head_.
+*/
+
+template <typename T,
+          std::size_t Capacity = (sizeof(T) <= (128 - 2 * sizeof(void*)) / 4
+                                      ? (128 - 2 * sizeof(void*)) / sizeof(T)
+                                      : 4)>
+class UnrolledLinkedList {
+    static_assert(Capacity >= 2, "Capacity must be at least 2");
+
+    struct Node;
+
+public:
+    // Iterador hacia delante: nodo actual y posición dentro de su array
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator() : node_(nullptr), offset_(0) {}
+
+        // Un iterator se puede convertir en const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node_(other.node_), offset_(other.offset_) {}
+
+        reference operator*() const {
+            return *node_->slot(offset_);
+        }
+
+        pointer operator->() const {
+            return node_->slot(offset_);
+        }
+
+        BasicIterator& operator++() {
+            if (++offset_ == node_->count) {
+                node_ = node_->next;
+                offset_ = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.node_ == b.node_ && a.offset_ == b.offset_;
+        }
+
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return !(a == b);
+        }
+
+    private:
+        friend class UnrolledLinkedList;
+        template <bool>
+        friend class BasicIterator;
+
+        Node* node_;            // nullptr es end()
+        std::size_t offset_;
+
+        BasicIterator(Node* node, std::size_t offset) : node_(node), offset_(offset) {}
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    // Constructor por defecto
+    UnrolledLinkedList()
+        : head_(nullptr), tail_(nullptr), size_(0), cursorPrev_(nullptr), cursorNode_(nullptr), cursorFirst_(0) {}
+
+    // Constructor de copia
+    UnrolledLinkedList(const UnrolledLinkedList& other)
+        : head_(nullptr), tail_(nullptr), size_(0), cursorPrev_(nullptr), cursorNode_(nullptr), cursorFirst_(0) {
+        copy(other);
+    }
+
+    // Operador =
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this != &other) {
+            clear();
+            copy(other);
+        }
+
+        return *this;
+    }
+
+    // Destructor
+    ~UnrolledLinkedList() {
+        clear();
+    }
+
+    // Comprueba si está vacío
+    bool empty() const {
+        return head_ == nullptr;
+    }
+
+    // Devuelve el número de elementos
+    std::size_t size() const {
+        return size_;
+    }
+
+    // Máximo de elementos por nodo
+    static constexpr std::size_t nodeCapacity() {
+        return Capacity;
+    }
+
+    // Elimina todos los elementos
+    void clear() {
+        while (head_ != nullptr) {
+            Node* temp = head_;
+            head_ = head_->next;
+            destroyNode(temp);
+        }
+        tail_ = nullptr;
+        size_ = 0;
+        invalidateCursor();
+    }
+
+    // Inserta un elemento al principio
+    void pushFront(const T& value) {
+        T item(value);
+
+        if (empty()) {
+            head_ = tail_ = new Node();
+        } else if (head_->count == Capacity) {
+            split(head_);
+            // El nodo nuevo queda entre head_ y el que lo seguía
+            if (cursorPrev_ == head_) {
+                cursorPrev_ = head_->next;
+            }
+        }
+
+        // Los nodos que van detrás de head_ avanzan una posición
+        if (cursorNode_ != nullptr && cursorNode_ != head_) {
+            ++cursorFirst_;
+        }
+
+        insertInNode(head_, 0, std::move(item));
+        ++size_;
+    }
+
+    // Inserta un elemento al final
+    void pushBack(const T& value) {
+        T item(value);
+
+        // Con el último nodo lleno abrimos uno nuevo en lugar de partirlo:
+        // así una secuencia de pushBack deja todos los nodos llenos
+        if (empty()) {
+            head_ = tail_ = new Node();
+        } else if (tail_->count == Capacity) {
+            Node* newNode = new Node();
+            tail_->next = newNode;
+            tail_ = newNode;
+        }
+
+        new (tail_->slot(tail_->count)) T(std::move(item));
+        ++tail_->count;
+        ++size_;
+    }
+
+    // Inserta en un índice específico
+    void insert(std::size_t index, const T& value) {
+        if (index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        if (index == size_) {
+            pushBack(value);
+            return;
+        }
+
+        T item(value);
+        std::size_t offset = 0;
+        Node* node = nodeAt(index, offset);
+
+        // Nodo lleno: lo partimos y el elemento va a la mitad que le corresponda.
+        // El cursor sigue en node, cuyo primer índice no cambia.
+        if (node->count == Capacity) {
+            split(node);
+            if (offset > node->count) {
+                offset -= node->count;
+                node = node->next;
+            }
+        }
+
+        insertInNode(node, offset, std::move(item));
+        ++size_;
+    }
+
+    // Elimina un elemento por primera aparición
+    bool remove(const T& value) {
+        Node* prev = nullptr;
+        Node* node = head_;
+        while (node != nullptr) {
+            for (std::size_t i = 0; i < node->count; ++i) {
+                if (*node->slot(i) == value) {
+                    eraseFromNode(prev, node, i);
+                    invalidateCursor();
+                    return true;
+                }
+            }
+            prev = node;
+            node = node->next;
+        }
+
+        return false;
+    }
+
+    // Elimina un elemento en una posición específica
+    void removeAt(std::size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        std::size_t offset = 0;
+        Node* node = nodeAt(index, offset);
+
+        // Si el nodo desaparece el cursor apuntaría a memoria liberada
+        if (eraseFromNode(cursorPrev_, node, offset)) {
+            invalidateCursor();
+        }
+    }
+
+    // Accede a un elemento en la posición
+    T& at(std::size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        // El último nodo está siempre a mano
+        std::size_t tailFirst = size_ - tail_->count;
+        if (index >= tailFirst) {
+            return *tail_->slot(index - tailFirst);
+        }
+
+        std::size_t offset = 0;
+        return *nodeAt(index, offset)->slot(offset);
+    }
+
+    iterator begin() {
+        return iterator(head_, 0);
+    }
+
+    iterator end() {
+        return iterator(nullptr, 0);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head_, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, 0);
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator(head_, 0);
+    }
+
+    const_iterator cend() const {
+        return const_iterator(nullptr, 0);
+    }
+
+    // Imprime cada nodo entre corchetes para ver cómo se reparten los elementos
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty list]\n";
+            return;
+        }
+
+        std::cout << "Head -> ";
+        for (Node* node = head_; node != nullptr; node = node->next) {
+            std::cout << "[";
+            for (std::size_t i = 0; i < node->count; ++i) {
+                std::cout << *node->slot(i);
+                if (i + 1 < node->count) {
+                    std::cout << ", ";
+                }
+            }
+            std::cout << "] -> ";
+        }
+        std::cout << "nullptr\n";
+    }
+
+private:
+    // Nodo de dos líneas de caché con el tamaño por defecto. La memoria del
+    // array se reserva sin construir los T: solo las count primeras
+    // posiciones contienen objetos vivos.
+    struct alignas(alignof(T) > 64 ? alignof(T) : 64) Node {
+        Node* next;
+        std::size_t count;
+        alignas(T) unsigned char storage[sizeof(T) * Capacity];
+
+        Node() : next(nullptr), count(0) {}
+
+        T* slot(std::size_t index) {
+            return std::launder(reinterpret_cast<T*>(storage) + index);
+        }
+    };
+
+    Node* head_;
+    Node* tail_;
+    std::size_t size_;
+
+    // Cursor: último nodo al que se llegó por índice, su anterior y el índice
+    // de su primer elemento. Guardar el anterior permite desenlazar el nodo
+    // si se queda vacío sin volver a recorrer la lista.
+    mutable Node* cursorPrev_;
+    mutable Node* cursorNode_;   // nullptr si no hay cursor válido
+    mutable std::size_t cursorFirst_;
+
+    void invalidateCursor() const {
+        cursorPrev_ = nullptr;
+        cursorNode_ = nullptr;
+        cursorFirst_ = 0;
+    }
+
+    // Nodo que contiene la posición index (< size_) y su posición dentro de él.
+    // Salta nodos enteros, partiendo del cursor si está antes, y deja el cursor en él.
+    Node* nodeAt(std::size_t index, std::size_t& offset) const {
+        Node* prev = nullptr;
+        Node* node = head_;
+        std::size_t first = 0;
+        if (cursorNode_ != nullptr && cursorFirst_ <= index) {
+            prev = cursorPrev_;
+            node = cursorNode_;
+            first = cursorFirst_;
+        }
+
+        while (index - first >= node->count) {
+            first += node->count;
+            prev = node;
+            node = node->next;
+        }
+
+        cursorPrev_ = prev;
+        cursorNode_ = node;
+        cursorFirst_ = first;
+        offset = index - first;
+        return node;
+    }
+
+    // Mueve el elemento de from a la posición libre to
+    static void relocate(T* from, T* to) {
+        new (to) T(std::move(*from));
+        from->~T();
+    }
+
+    // Inserta item en la posición offset de un nodo con hueco
+    static void insertInNode(Node* node, std::size_t offset, T&& item) {
+        for (std::size_t i = node->count; i > offset; --i) {
+            relocate(node->slot(i - 1), node->slot(i));
+        }
+        new (node->slot(offset)) T(std::move(item));
+        ++node->count;
+    }
+
+    // Parte un nodo lleno: la mitad superior pasa a un nodo nuevo justo detrás
+    void split(Node* node) {
+        Node* newNode = new Node();
+        std::size_t keep = Capacity / 2;
+        for (std::size_t i = keep; i < Capacity; ++i) {
+            relocate(node->slot(i), newNode->slot(i - keep));
+        }
+        newNode->count = Capacity - keep;
+        node->count = keep;
+
+        newNode->next = node->next;
+        node->next = newNode;
+        if (node == tail_) {
+            tail_ = newNode;
+        }
+    }
+
+    // Borra la posición offset de node (prev es su anterior) y reequilibra.
+    // Devuelve true si node se ha liberado.
+    bool eraseFromNode(Node* prev, Node* node, std::size_t offset) {
+        node->slot(offset)->~T();
+        for (std::size_t i = offset + 1; i < node->count; ++i) {
+            relocate(node->slot(i), node->slot(i - 1));
+        }
+        --node->count;
+        --size_;
+
+        // Si el nodo se queda vacío se desenlaza
+        if (node->count == 0) {
+            if (prev == nullptr) {
+                head_ = node->next;
+            } else {
+                prev->next = node->next;
+            }
+            if (node == tail_) {
+                tail_ = prev;
+            }
+            delete node;
+            return true;
+        }
+
+        Node* next = node->next;
+        if (node->count >= Capacity / 2 || next == nullptr) {
+            return false;
+        }
+
+        if (node->count + next->count <= Capacity) {
+            // Caben los dos en uno: fusionamos el siguiente en node
+            for (std::size_t i = 0; i < next->count; ++i) {
+                relocate(next->slot(i), node->slot(node->count + i));
+            }
+            node->count += next->count;
+            next->count = 0;
+            node->next = next->next;
+            if (next == tail_) {
+                tail_ = node;
+            }
+            delete next;
+        } else {
+            // No caben: node toma del principio del siguiente lo justo para igualarlos
+            std::size_t moved = (next->count - node->count) / 2;
+            for (std::size_t i = 0; i < moved; ++i) {
+                relocate(next->slot(i), node->slot(node->count + i));
+            }
+            for (std::size_t i = moved; i < next->count; ++i) {
+                relocate(next->slot(i), next->slot(i - moved));
+            }
+            node->count += moved;
+            next->count -= moved;
+        }
+
+        return false;
+    }
+
+    static void destroyNode(Node* node) {
+        for (std::size_t i = 0; i < node->count; ++i) {
+            node->slot(i)->~T();
+        }
+        delete node;
+    }
+
+    void copy(const UnrolledLinkedList& other) {
+        head_ = nullptr;
+        tail_ = nullptr;
+        size_ = 0;
+
+        for (Node* node = other.head_; node != nullptr; node = node->next) {
+            for (std::size_t i = 0; i < node->count; ++i) {
+                pushBack(*node->slot(i));
+            }
+        }
+    }
+};
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Benchmark.h"
+#include "LinkedList.h"
+#include "UnrolledLinkedList.h"
+
+// BENCHMARK: UnrolledLinkedList frente a LinkedList
+//
+// Uso: ./UnrolledLinkedListBenchmark [exponente_maximo] [exponente_maximo_aleatorio] [operaciones]
+// Para listas de 10^5 a 10^exponente_maximo (10^7 por defecto) de int se mide:
+//  - "recorrido": range-for sobre toda la lista, en ns por elemento
+//  - "at aleatorio": 'operaciones' (1000 por defecto) at(i) con i al azar, en ns por acceso
+//  - "insert en medio": 'operaciones' insert(i, v) con i al azar en la mitad central
+// LinkedList se mide dos veces: con los nodos reservados en orden ("contigua"),
+// como quedan tras una serie de pushBack en un programa recién arrancado, y con
+// los nodos repartidos al azar por el heap ("dispersa"), como quedan en un
+// programa que lleva tiempo reservando y liberando memoria.
+// Los patrones aleatorios cuestan O(n) por operación en LinkedList y solo se
+// miden hasta 10^exponente_maximo_aleatorio (10^5 por defecto).
+// Antes se comprueba con una secuencia aleatoria de operaciones que ambas listas
+// dan el mismo resultado, también con nodos pequeños que se parten y fusionan a menudo.
+
+template <typename List>
+static void checkSame(LinkedList<int>& reference, List& list) {
+    check(reference.size() == list.size(), "size() mismatch");
+    typename List::iterator it = list.begin();
+    for (int value : reference) {
+        check(it != list.end() && *it == value, "iteration mismatch");
+        ++it;
+    }
+    check(it == list.end(), "iteration does not end at end()");
+}
+
+template <typename List>
+static void verify(std::size_t steps) {
+    LinkedList<int> reference;
+    List list;
+    Random random(steps);
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        int value = static_cast<int>(random.next(100));
+        std::size_t size = reference.size();
+        switch (random.next(6)) {
+            case 0:
+                reference.pushFront(value);
+                list.pushFront(value);
+                break;
+            case 1:
+                reference.pushBack(value);
+                list.pushBack(value);
+                break;
+            case 2: {
+                std::size_t index = random.next(size + 1);
+                reference.insert(index, value);
+                list.insert(index, value);
+                break;
+            }
+            case 3:
+                check(reference.remove(value) == list.remove(value), "remove() mismatch");
+                break;
+            case 4:
+                if (size > 0) {
+                    std::size_t index = random.next(size);
+                    reference.removeAt(index);
+                    list.removeAt(index);
+                }
+                break;
+            default:
+                if (size > 0) {
+                    std::size_t index = random.next(size);
+                    check(reference.at(index) == list.at(index), "at() mismatch");
+                }
+                break;
+        }
+
+        // Cuando la lista crece demasiado la vaciamos casi entera para ejercitar las fusiones
+        if (reference.size() > 500) {
+            while (reference.size() > 20) {
+                std::size_t index = random.next(reference.size());
+                reference.removeAt(index);
+                list.removeAt(index);
+            }
+        }
+        if (step % 64 == 0) {
+            checkSame(reference, list);
+        }
+    }
+    checkSame(reference, list);
+
+    List copy(list);
+    checkSame(reference, copy);
+}
+
+template <typename List>
+static void fill(List& list, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        list.pushBack(static_cast<int>(i));
+    }
+}
+
+// Rellena una LinkedList con los nodos desordenados en memoria: se reservan y
+// liberan en orden aleatorio n bloques del tamaño de un nodo, y el allocator
+// (al menos el de glibc) los reutiliza en el orden en que se liberaron.
+static void fillScattered(LinkedList<int>& list, std::size_t n) {
+    std::vector<void*> blocks(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        blocks[i] = ::operator new(sizeof(int) + sizeof(void*));
+    }
+    Random random(n);
+    for (std::size_t i = n - 1; i > 0; --i) {
+        std::swap(blocks[i], blocks[random.next(i + 1)]);
+    }
+    for (void* block : blocks) {
+        ::operator delete(block);
+    }
+    fill(list, n);
+}
+
+template <typename List>
+static double timeScan(const List& list, long long expected) {
+    Stopwatch watch;
+    long long sum = 0;
+    for (int value : list) {
+        sum += value;
+    }
+    double ns = watch.elapsedNanoseconds() / static_cast<double>(list.size());
+    check(sum == expected, "scan sum is wrong");
+    doNotOptimize(sum);
+    return ns;
+}
+
+template <typename List>
+static double timeRandomAt(List& list, std::size_t operations) {
+    Random random(operations);
+    long long sum = 0;
+    long long expected = 0;
+    Stopwatch watch;
+    for (std::size_t k = 0; k < operations; ++k) {
+        std::size_t index = random.next(list.size());
+        sum += list.at(index);
+        expected += static_cast<long long>(index);
+    }
+    double ns = watch.elapsedNanoseconds() / static_cast<double>(operations);
+    check(sum == expected, "random at() sum is wrong");
+    return ns;
+}
+
+// Inserta en posiciones al azar de la mitad central; devuelve la suma de control posterior
+template <typename List>
+static double timeMiddleInsert(List& list, std::size_t operations, long long& checksum) {
+    Random random(operations);
+    Stopwatch watch;
+    for (std::size_t k = 0; k < operations; ++k) {
+        std::size_t size = list.size();
+        list.insert(size / 4 + random.next(size / 2), -1);
+    }
+    double ns = watch.elapsedNanoseconds() / static_cast<double>(operations);
+
+    checksum = 0;
+    std::size_t position = 0;
+    for (int value : list) {
+        checksum += static_cast<long long>(value) * static_cast<long long>(position % 7 + 1);
+        ++position;
+    }
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExp = argOrDefault(argc, argv, 1, 7);
+    std::size_t maxRandomExp = argOrDefault(argc, argv, 2, 5);
+    std::size_t operations = argOrDefault(argc, argv, 3, 1000);
+
+    verify<UnrolledLinkedList<int, 2>>(200000);
+    verify<UnrolledLinkedList<int, 5>>(200000);
+    verify<UnrolledLinkedList<int>>(200000);
+    std::cout << "Verificacion frente a LinkedList: OK\n";
+    std::cout << "Elementos por nodo (int): " << UnrolledLinkedList<int>::nodeCapacity() << "\n\n";
+
+    std::cout << "lista                                   n         ns/op\n";
+    for (std::size_t exp = 5; exp <= maxExp; ++exp) {
+        std::size_t n = powerOfTen(exp);
+        long long expected = static_cast<long long>(n) * static_cast<long long>(n - 1) / 2;
+        bool measureRandom = exp <= maxRandomExp;
+        std::string suffix = " 10^" + std::to_string(exp);
+
+        {
+            LinkedList<int> list;
+            fill(list, n);
+            printResult("recorrido contigua" + suffix, n, timeScan(list, expected));
+            if (measureRandom) {
+                printResult("at aleatorio contigua" + suffix, operations, timeRandomAt(list, operations));
+            }
+        }
+
+        long long linkedChecksum = 0;
+        {
+            LinkedList<int> list;
+            fillScattered(list, n);
+            printResult("recorrido dispersa" + suffix, n, timeScan(list, expected));
+            if (measureRandom) {
+                printResult("at aleatorio dispersa" + suffix, operations, timeRandomAt(list, operations));
+                printResult("insert medio dispersa" + suffix, operations,
+                            timeMiddleInsert(list, operations, linkedChecksum));
+            }
+        }
+
+        {
+            UnrolledLinkedList<int> list;
+            fill(list, n);
+            printResult("recorrido unrolled" + suffix, n, timeScan(list, expected));
+            if (measureRandom) {
+                long long checksum = 0;
+                printResult("at aleatorio unrolled" + suffix, operations, timeRandomAt(list, operations));
+                printResult("insert medio unrolled" + suffix, operations,
+                            timeMiddleInsert(list, operations, checksum));
+                check(checksum == linkedChecksum, "middle inserts disagree with LinkedList");
+            }
+        }
+
+        std::cout << "\n";
+    }
+
+    return 0;
+}
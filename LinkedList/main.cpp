@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <numeric>
+#include <utility>
 
+#include "IndexedLinkedList.h"
 #include "LinkedList.h"
+#include "UnrolledLinkedList.h"
 
 int main() {
     LinkedList<int> list;
@@ -34,5 +40,74 @@ int main() {
     assignedList = list;
     assignedList.print();
 
+    // Iteradores: range-for y algoritmos de <algorithm>/<numeric>
+    std::cout << "Range-for:";
+    for (int value : list) {
+        std::cout << " " << value;
+    }
+    std::cout << "\n";
+    std::cout << "Suma: " << std::accumulate(list.cbegin(), list.cend(), 0) << "\n"; // 139
+
+    // insert_after / erase_after en O(1) a partir de un iterador
+    LinkedList<int>::iterator it = std::find(list.begin(), list.end(), 99);
+    list.insert_after(it, 50);
+    list.print(); // Head -> 10 -> 99 -> 50 -> 30 -> nullptr
+    list.erase_after(list.begin());
+    list.print(); // Head -> 10 -> 50 -> 30 -> nullptr
+
+    // sort: reenlaza los nodos existentes, sin copiar ni reservar memoria
+    list.pushFront(70);
+    list.pushBack(20);
+    list.sort();
+    list.print(); // Head -> 10 -> 20 -> 30 -> 50 -> 70 -> nullptr
+    list.sort(std::greater<int>());
+    list.print(); // Head -> 70 -> 50 -> 30 -> 20 -> 10 -> nullptr
+    list.pushBack(5); // tail_ sigue siendo correcto tras ordenar
+    list.print(); // Head -> 70 -> 50 -> 30 -> 20 -> 10 -> 5 -> nullptr
+
+    // splitAt / append / splice: mueven nodos entre listas sin copiarlos
+    LinkedList<int> rest = list.splitAt(3);
+    list.print(); // Head -> 70 -> 50 -> 30 -> nullptr
+    rest.print(); // Head -> 20 -> 10 -> 5 -> nullptr
+    LinkedList<int> extra;
+    extra.pushBack(1);
+    extra.pushBack(2);
+    rest.splice(1, extra);    // extra queda vacía
+    rest.print(); // Head -> 20 -> 1 -> 2 -> 10 -> 5 -> nullptr
+    list.append(std::move(rest));
+    list.pushBack(0);         // tail_ apunta al último nodo movido
+    list.print(); // Head -> 70 -> 50 -> 30 -> 20 -> 1 -> 2 -> 10 -> 5 -> 0 -> nullptr
+    std::cout << "Tamaños: " << list.size() << ", " << rest.size() << ", " << extra.size() << "\n"; // 9, 0, 0
+
+    // UnrolledLinkedList: varios elementos por nodo (aquí 4 para ver los nodos)
+    UnrolledLinkedList<int, 4> unrolled;
+    for (int i = 1; i <= 8; ++i) {
+        unrolled.pushBack(i * 10);
+    }
+    unrolled.print(); // Head -> [10, 20, 30, 40] -> [50, 60, 70, 80] -> nullptr
+
+    unrolled.insert(2, 25);   // El primer nodo está lleno: se parte en dos
+    unrolled.print(); // Head -> [10, 20, 25] -> [30, 40] -> [50, 60, 70, 80] -> nullptr
+
+    unrolled.removeAt(3);     // [40] baja de la mitad: toma elementos del siguiente
+    unrolled.print(); // Head -> [10, 20, 25] -> [40, 50] -> [60, 70, 80] -> nullptr
+
+    unrolled.remove(40);      // [50] cabe con el siguiente: se fusionan
+    unrolled.print(); // Head -> [10, 20, 25] -> [50, 60, 70, 80] -> nullptr
+    std::cout << "Element at index 4: " << unrolled.at(4) << "\n"; // 60
+
+    // IndexedLinkedList: orden de inserción con remove y contains en O(1) de media
+    IndexedLinkedList<int> sessions;
+    sessions.pushBack(7);
+    sessions.pushBack(3);
+    sessions.pushBack(9);
+    sessions.pushBack(3);     // Ya está: no se inserta
+    sessions.print(); // Head -> 7 -> 3 -> 9 -> nullptr
+    sessions.remove(3);       // La tabla da el nodo previo (7), sin recorrer la lista
+    sessions.pushBack(3);     // Renovar: vuelve al final
+    sessions.print(); // Head -> 7 -> 9 -> 3 -> nullptr
+    std::cout << std::boolalpha << "contains(9): " << sessions.contains(9)
+              << ", contains(4): " << sessions.contains(4) << "\n"; // true, false
+
     return 0;
 }
@@ -0,0 +1,357 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include "RawDoublyLinkedList.h"
+
+/*
+    Caché LRU (least recently used) con capacidad fija, repartida en
+    fragmentos (shards) con un mutex cada uno.
+
+    Cada fragmento combina dos estructuras:
+
+      - Una RawDoublyLinkedList de entradas {clave, valor} ordenada por uso:
+        la más reciente al principio y la candidata a expulsar al final.
+      - Una tabla hash de direccionamiento abierto (sondeo lineal, como la de
+        IndexedLinkedList) de clave a iterador de la lista.
+
+    Con el iterador a mano, un acierto se lleva al principio con
+    move_to_front(it) y la expulsión borra el último con erase(it): get, put
+    y la expulsión son O(1) de media, sin el recorrido de remove(value).
+
+    La clave decide el fragmento, así que dos hilos solo compiten por el
+    mismo mutex si sus claves caen en el mismo fragmento. A cambio, el orden
+    LRU es local a cada fragmento: se expulsa la entrada menos usada de su
+    fragmento, no necesariamente la de toda la caché. Con un solo fragmento
+    el comportamiento es el de una caché LRU exacta.
+*/
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class LruCache {
+public:
+    // Contadores agregados de todos los fragmentos
+    struct Stats {
+        std::uint64_t hits;
+        std::uint64_t misses;
+        std::uint64_t evictions;
+
+        // Fracción de get() que encontraron la clave
+        double hitRate() const {
+            std::uint64_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    // capacity: número máximo de entradas de toda la caché.
+    // shards: número de fragmentos; se redondea a potencia de dos y nunca
+    // supera capacity, para que todos puedan guardar al menos una entrada.
+    explicit LruCache(std::size_t capacity, std::size_t shards = defaultShards(), const Hash& hash = Hash())
+        : shards_(nullptr), shardCount_(1), shardBits_(0), capacity_(capacity), hash_(hash) {
+        if (capacity == 0) {
+            throw std::invalid_argument("capacity must be greater than zero");
+        }
+
+        while (shardCount_ * 2 <= shards && shardCount_ * 2 <= capacity) {
+            shardCount_ *= 2;
+            ++shardBits_;
+        }
+
+        // El resto de la división se reparte entre los primeros fragmentos
+        shards_ = new Shard[shardCount_];
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            shards_[i].init(capacity / shardCount_ + (i < capacity % shardCount_ ? 1 : 0));
+        }
+    }
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    // Destructor
+    ~LruCache() {
+        delete[] shards_;
+    }
+
+    // Devuelve una copia del valor de key y la marca como la más reciente de
+    // su fragmento, o std::nullopt si no está.
+    std::optional<V> get(const K& key) {
+        std::size_t hash = mix(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::size_t slot = shard.findSlot(key, hash, shardBits_);
+        if (slot == kNotFound) {
+            ++shard.misses;
+            return std::nullopt;
+        }
+
+        ++shard.hits;
+        Iterator entry = shard.slots[slot].entry;
+        shard.recency.move_to_front(entry);
+        return entry->value;
+    }
+
+    // Inserta key o actualiza su valor, y la marca como la más reciente. Si
+    // el fragmento está lleno, antes expulsa su entrada menos usada.
+    void put(const K& key, const V& value) {
+        std::size_t hash = mix(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::size_t slot = shard.findSlot(key, hash, shardBits_);
+        if (slot != kNotFound) {
+            Iterator entry = shard.slots[slot].entry;
+            entry->value = value;
+            shard.recency.move_to_front(entry);
+            return;
+        }
+
+        if (shard.recency.getSize() == shard.capacity) {
+            Iterator last = std::prev(shard.recency.end());
+            shard.eraseSlot(shard.findSlotOf(last, shardBits_), shardBits_);
+            shard.recency.erase(last);
+            ++shard.evictions;
+        }
+
+        shard.recency.pushFront(Entry{key, value, hash});
+        shard.placeSlot(shard.recency.begin(), hash, shardBits_);
+    }
+
+    // Elimina key si está. Devuelve false si no estaba.
+    bool erase(const K& key) {
+        std::size_t hash = mix(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::size_t slot = shard.findSlot(key, hash, shardBits_);
+        if (slot == kNotFound) {
+            return false;
+        }
+
+        Iterator entry = shard.slots[slot].entry;
+        shard.eraseSlot(slot, shardBits_);
+        shard.recency.erase(entry);
+        return true;
+    }
+
+    // Comprueba si key está, sin cambiar el orden ni los contadores
+    bool contains(const K& key) const {
+        std::size_t hash = mix(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.findSlot(key, hash, shardBits_) != kNotFound;
+    }
+
+    // Número de entradas. Con otros hilos escribiendo es solo una foto:
+    // cada fragmento se cuenta en un momento distinto.
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total += shards_[i].recency.getSize();
+        }
+        return total;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // Número máximo de entradas
+    std::size_t capacity() const {
+        return capacity_;
+    }
+
+    std::size_t shardCount() const {
+        return shardCount_;
+    }
+
+    // Suma de los contadores de todos los fragmentos
+    Stats stats() const {
+        Stats total{0, 0, 0};
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total.hits += shards_[i].hits;
+            total.misses += shards_[i].misses;
+            total.evictions += shards_[i].evictions;
+        }
+        return total;
+    }
+
+    // Vacía la caché. Los contadores se conservan.
+    void clear() {
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            shards_[i].recency.clear();
+            shards_[i].clearSlots();
+        }
+    }
+
+    // Imprime cada fragmento de la entrada más reciente a la menos usada
+    void print() const {
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            std::cout << "Shard " << i << ": ";
+            if (shards_[i].recency.empty()) {
+                std::cout << "[Empty]\n";
+                continue;
+            }
+
+            std::cout << "MRU -> ";
+            for (auto it = shards_[i].recency.begin(); it != shards_[i].recency.end(); ++it) {
+                if (it != shards_[i].recency.begin()) {
+                    std::cout << " | ";
+                }
+                std::cout << it->key << ":" << it->value;
+            }
+            std::cout << " <- LRU\n";
+        }
+    }
+
+private:
+    // Entrada de la lista de uso. Guarda el hash para poder encontrar su
+    // posición en la tabla al expulsarla sin volver a calcularlo.
+    struct Entry {
+        K key;
+        V value;
+        std::size_t hash;
+    };
+
+    using Iterator = typename RawDoublyLinkedList<Entry>::iterator;
+
+    // Posición de la tabla: iterador a la entrada y su hash.
+    // Un iterador nulo (igual a end()) marca una posición libre.
+    struct Slot {
+        Iterator entry;
+        std::size_t hash;
+    };
+
+    static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
+
+    // Cada fragmento ocupa sus propias líneas de caché: así el mutex de uno
+    // no comparte línea con el de su vecino.
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        RawDoublyLinkedList<Entry> recency;   // Principio: más reciente
+        Slot* slots = nullptr;
+        std::size_t slotCount = 0;            // Potencia de dos
+        unsigned shift = 64;                  // 64 - log2(slotCount)
+        std::size_t capacity = 0;             // Entradas como máximo
+
+        // Protegidos por mutex
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+
+        ~Shard() {
+            delete[] slots;
+        }
+
+        // La tabla no crece: se dimensiona para capacity entradas con una
+        // carga máxima de 3/4, que la expulsión nunca deja superar.
+        void init(std::size_t maxEntries) {
+            capacity = maxEntries;
+            slotCount = 2;
+            shift = 63;
+            while (slotCount * 3 < capacity * 4) {
+                slotCount *= 2;
+                --shift;
+            }
+            slots = new Slot[slotCount];
+            clearSlots();
+        }
+
+        void clearSlots() {
+            for (std::size_t i = 0; i < slotCount; ++i) {
+                slots[i].entry = Iterator();
+            }
+        }
+
+        // Los bits altos del hash ya han elegido el fragmento: la posición
+        // ideal sale de los siguientes.
+        std::size_t home(std::size_t hash, unsigned shardBits) const {
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) << shardBits) >> shift);
+        }
+
+        // Posición de key, o kNotFound
+        std::size_t findSlot(const K& key, std::size_t hash, unsigned shardBits) const {
+            std::size_t mask = slotCount - 1;
+            for (std::size_t i = home(hash, shardBits);; i = (i + 1) & mask) {
+                const Slot& slot = slots[i];
+                if (slot.entry == Iterator()) {
+                    return kNotFound;
+                }
+                if (slot.hash == hash && slot.entry->key == key) {
+                    return i;
+                }
+            }
+        }
+
+        // Posición de una entrada concreta: se compara el iterador, no la clave
+        std::size_t findSlotOf(Iterator entry, unsigned shardBits) const {
+            std::size_t mask = slotCount - 1;
+            for (std::size_t i = home(entry->hash, shardBits);; i = (i + 1) & mask) {
+                if (slots[i].entry == entry) {
+                    return i;
+                }
+            }
+        }
+
+        void placeSlot(Iterator entry, std::size_t hash, unsigned shardBits) {
+            std::size_t mask = slotCount - 1;
+            std::size_t i = home(hash, shardBits);
+            while (slots[i].entry != Iterator()) {
+                i = (i + 1) & mask;
+            }
+            slots[i].entry = entry;
+            slots[i].hash = hash;
+        }
+
+        // Borrado por desplazamiento hacia atrás, como en IndexedLinkedList
+        void eraseSlot(std::size_t i, unsigned shardBits) {
+            std::size_t mask = slotCount - 1;
+            std::size_t j = i;
+            while (true) {
+                j = (j + 1) & mask;
+                if (slots[j].entry == Iterator()) {
+                    break;
+                }
+                std::size_t k = home(slots[j].hash, shardBits);
+                // j puede ocupar el hueco i si su posición ideal k no está en (i, j]
+                bool between = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+                if (!between) {
+                    slots[i] = slots[j];
+                    i = j;
+                }
+            }
+            slots[i].entry = Iterator();
+        }
+    };
+
+    Shard* shards_;
+    std::size_t shardCount_;   // Potencia de dos
+    unsigned shardBits_;       // log2(shardCount_)
+    std::size_t capacity_;
+    Hash hash_;
+
+    static std::size_t defaultShards() {
+        std::size_t cores = std::thread::hardware_concurrency();
+        return cores > 0 ? cores * 4 : 16;
+    }
+
+    // Hash de Fibonacci sobre el de Hash: std::hash de enteros suele ser la
+    // identidad y así los bits altos, que eligen fragmento, quedan repartidos.
+    std::size_t mix(const K& key) const {
+        return static_cast<std::size_t>(static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    Shard& shardFor(std::size_t hash) const {
+        return shardBits_ == 0 ? shards_[0] : shards_[static_cast<std::uint64_t>(hash) >> (64 - shardBits_)];
+    }
+};
@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Benchmark.h"
+#include "LruCache.h"
+#include "DoublyLinkedList.h"
+
+// BENCHMARK: LruCache (hash + lista doble, por fragmentos) frente a la caché
+// hecha a mano con DoublyLinkedList y un mutex global
+//
+// Uso: ./LruCacheBenchmark [claves] [capacidad] [operaciones_totales] [hilos_maximos] [fragmentos]
+// Cada operación pide una clave de 'claves' posibles (10^6 por defecto) con
+// distribución de Zipf (s = 0.99): unas pocas claves reciben casi todo el
+// tráfico. Si está en la caché se comprueba su valor; si no, se inserta,
+// como haría una caché de lectura delante de un almacén lento. La caché
+// guarda 'capacidad' entradas (10^5 por defecto). Se mide el rendimiento
+// agregado con 1, 2, 4 ... hilos_maximos (32 por defecto) de:
+//  - DoublyLinkedList + mutex: recency con remove(value) en O(n) y un
+//    std::unordered_map de valores, todo bajo un único mutex (situación de
+//    partida). Es tan lenta que solo hace la centésima parte de las operaciones.
+//  - LruCache con un solo fragmento (un único mutex, pero get/put en O(1))
+//  - LruCache con 'fragmentos' mutex independientes (64 por defecto)
+// Antes se comprueba la caché de un fragmento frente a un modelo LRU con
+// std::list y std::unordered_map, y la de varios fragmentos con invariantes.
+
+// Distribución de Zipf sobre [0, n): la clave k sale con probabilidad
+// proporcional a 1 / (k + 1)^s. Se precalcula la función de distribución y
+// cada muestra es una búsqueda binaria.
+class Zipf {
+public:
+    Zipf(std::size_t n, double s) : cdf_(n) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < n; ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), s);
+            cdf_[k] = sum;
+        }
+        for (double& value : cdf_) {
+            value /= sum;
+        }
+    }
+
+    long long sample(Random& random) const {
+        std::vector<double>::const_iterator it = std::upper_bound(cdf_.begin(), cdf_.end(), random.nextDouble());
+        return it == cdf_.end() ? static_cast<long long>(cdf_.size() - 1) : static_cast<long long>(it - cdf_.begin());
+    }
+
+private:
+    std::vector<double> cdf_;
+};
+
+// Valor que le corresponde a cada clave, para comprobar los aciertos
+static long long valueOf(long long key) {
+    return key * 2 + 1;
+}
+
+// Caché hecha a mano con DoublyLinkedList protegida por un único mutex global
+// (situación de partida): un acierto busca la clave en la lista con remove(value)
+class MutexDoublyLru {
+public:
+    explicit MutexDoublyLru(std::size_t capacity) : capacity_(capacity) {}
+
+    std::optional<long long> get(long long key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::unordered_map<long long, long long>::iterator it = values_.find(key);
+        if (it == values_.end()) {
+            return std::nullopt;
+        }
+        recency_.remove(key);
+        recency_.pushFront(key);
+        return it->second;
+    }
+
+    void put(long long key, long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::unordered_map<long long, long long>::iterator it = values_.find(key);
+        if (it != values_.end()) {
+            it->second = value;
+            recency_.remove(key);
+            recency_.pushFront(key);
+            return;
+        }
+        if (values_.size() == capacity_) {
+            std::size_t last = recency_.getSize() - 1;
+            values_.erase(recency_.at(last));
+            recency_.removeAt(last);
+        }
+        values_.emplace(key, value);
+        recency_.pushFront(key);
+    }
+
+private:
+    std::mutex mutex_;
+    std::size_t capacity_;
+    DoublyLinkedList<long long> recency_;
+    std::unordered_map<long long, long long> values_;
+};
+
+// Modelo de referencia: LRU exacta con std::list y std::unordered_map
+class ReferenceLru {
+public:
+    explicit ReferenceLru(std::size_t capacity) : capacity_(capacity), evictions_(0) {}
+
+    std::optional<long long> get(long long key) {
+        Map::iterator it = index_.find(key);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        order_.splice(order_.begin(), order_, it->second);
+        return it->second->second;
+    }
+
+    void put(long long key, long long value) {
+        Map::iterator it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = value;
+            order_.splice(order_.begin(), order_, it->second);
+            return;
+        }
+        if (order_.size() == capacity_) {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+            ++evictions_;
+        }
+        order_.emplace_front(key, value);
+        index_[key] = order_.begin();
+    }
+
+    bool erase(long long key) {
+        Map::iterator it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        order_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    std::size_t size() const {
+        return order_.size();
+    }
+
+    std::uint64_t evictions() const {
+        return evictions_;
+    }
+
+private:
+    using Order = std::list<std::pair<long long, long long>>;
+    using Map = std::unordered_map<long long, Order::iterator>;
+
+    std::size_t capacity_;
+    std::uint64_t evictions_;
+    Order order_;
+    Map index_;
+};
+
+// Un fragmento: tiene que coincidir operación a operación con el modelo
+static void verifyExact(std::size_t steps) {
+    LruCache<long long, long long> cache(50, 1);
+    ReferenceLru reference(50);
+    Random random(steps);
+    std::uint64_t gets = 0;
+    std::uint64_t hits = 0;
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        long long key = static_cast<long long>(random.next(120));
+        long long value = static_cast<long long>(random.next(1000));
+        switch (random.next(4)) {
+            case 0:
+            case 1: {
+                std::optional<long long> got = cache.get(key);
+                std::optional<long long> expected = reference.get(key);
+                check(got == expected, "get() does not match the reference LRU");
+                ++gets;
+                hits += expected ? 1 : 0;
+                break;
+            }
+            case 2:
+                cache.put(key, value);
+                reference.put(key, value);
+                break;
+            default:
+                check(cache.erase(key) == reference.erase(key), "erase() does not match the reference LRU");
+                break;
+        }
+        check(cache.size() == reference.size(), "size() does not match the reference LRU");
+    }
+
+    LruCache<long long, long long>::Stats stats = cache.stats();
+    check(stats.hits == hits && stats.hits + stats.misses == gets, "hit/miss counters are wrong");
+    check(stats.evictions == reference.evictions(), "eviction counter is wrong");
+
+    cache.clear();
+    check(cache.empty(), "clear() leaves entries");
+}
+
+// Varios fragmentos: el orden LRU es por fragmento, así que se comprueban invariantes
+static void verifySharded(std::size_t steps) {
+    const std::size_t capacity = 1000;
+    LruCache<long long, long long> cache(capacity, 16);
+    check(cache.shardCount() == 16, "shard count is not the requested one");
+    Random random(steps);
+    std::uint64_t gets = 0;
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        long long key = static_cast<long long>(random.next(5000));
+        std::optional<long long> got = cache.get(key);
+        ++gets;
+        if (got) {
+            check(*got == valueOf(key), "get() returns a wrong value");
+        } else {
+            cache.put(key, valueOf(key));
+            check(cache.contains(key), "put() key is not in the cache");
+        }
+    }
+
+    LruCache<long long, long long>::Stats stats = cache.stats();
+    check(stats.hits + stats.misses == gets, "hit/miss counters are wrong");
+    check(cache.size() == capacity, "a full cache does not hold 'capacity' entries");
+    check(stats.misses - stats.evictions == capacity, "eviction counter is wrong");
+
+    // Con menos capacidad que fragmentos pedidos, cada fragmento guarda una entrada
+    LruCache<int, int> tiny(3, 64);
+    check(tiny.shardCount() == 2, "shards are not limited by the capacity");
+}
+
+template <typename Cache>
+double run(Cache& cache, const Zipf& zipf, std::size_t threads, std::size_t totalOperations,
+           std::uint64_t& hits) {
+    std::size_t perThread = totalOperations / threads;
+    std::vector<std::uint64_t> threadHits(threads, 0);
+    std::vector<std::thread> workers;
+
+    Stopwatch watch;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            Random random(0x9E3779B97F4A7C15ULL * (t + 1));
+            // Se cuenta en local: threadHits[t] comparte línea de caché con los vecinos
+            std::uint64_t found = 0;
+            for (std::size_t i = 0; i < perThread; ++i) {
+                long long key = zipf.sample(random);
+                std::optional<long long> value = cache.get(key);
+                if (value) {
+                    check(*value == valueOf(key), "get() returns a wrong value");
+                    ++found;
+                } else {
+                    cache.put(key, valueOf(key));
+                }
+            }
+            threadHits[t] = found;
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = watch.elapsedSeconds();
+
+    hits = 0;
+    for (std::uint64_t count : threadHits) {
+        hits += count;
+    }
+    return static_cast<double>(perThread * threads) / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    std::size_t keys = argOrDefault(argc, argv, 1, 1000000);
+    std::size_t capacity = argOrDefault(argc, argv, 2, 100000);
+    std::size_t totalOperations = argOrDefault(argc, argv, 3, 2000000);
+    std::size_t maxThreads = argOrDefault(argc, argv, 4, 32);
+    std::size_t shards = argOrDefault(argc, argv, 5, 64);
+
+    verifyExact(100000);
+    verifySharded(100000);
+    std::cout << "Verificacion frente a una LRU de referencia: OK\n\n";
+
+    Zipf zipf(keys, 0.99);
+    shards = LruCache<long long, long long>(capacity, shards).shardCount();
+
+    std::cout << "hilos   DoublyLinkedList+mutex   LruCache 1 frag.   LruCache " << shards
+              << " frag.   aciertos   (Mops/s)\n";
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        std::uint64_t hits = 0;
+
+        MutexDoublyLru baseline(capacity);
+        double baselineRate = run(baseline, zipf, threads, totalOperations / 100, hits);
+
+        LruCache<long long, long long> single(capacity, 1);
+        double singleRate = run(single, zipf, threads, totalOperations, hits);
+
+        LruCache<long long, long long> sharded(capacity, shards);
+        double shardedRate = run(sharded, zipf, threads, totalOperations, hits);
+        LruCache<long long, long long>::Stats stats = sharded.stats();
+        check(stats.hits == hits, "hit counter does not match the hits seen by the threads");
+
+        std::cout << std::setw(5) << threads
+                  << std::setw(25) << std::fixed << std::setprecision(2) << baselineRate
+                  << std::setw(19) << singleRate
+                  << std::setw(19) << shardedRate
+                  << std::setw(10) << stats.hitRate() * 100.0 << "%\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <iostream>
+#include <optional>
+#include <string>
+#include "LruCache.h"
+
+int main() {
+
+    // Un solo fragmento: LRU exacta con 3 entradas
+    LruCache<int, std::string> cache(3, 1);
+
+    cache.put(1, "uno");
+    cache.put(2, "dos");
+    cache.put(3, "tres");
+    cache.print();
+
+    // Un acierto lleva la clave al principio
+    std::optional<std::string> value = cache.get(1);
+    std::cout << "get(1): " << (value ? *value : "no está") << "\n";
+    cache.print();
+
+    // La caché está llena: put(4) expulsa la menos usada (2)
+    cache.put(4, "cuatro");
+    cache.print();
+
+    value = cache.get(2);
+    std::cout << "get(2): " << (value ? *value : "no está") << "\n";
+
+    // Actualizar una clave que ya está no expulsa nada
+    cache.put(3, "TRES");
+    cache.print();
+
+    cache.erase(1);
+    cache.print();
+    std::cout << "Tamaño: " << cache.size() << " de " << cache.capacity() << "\n";
+
+    LruCache<int, std::string>::Stats stats = cache.stats();
+    std::cout << "Aciertos: " << stats.hits
+              << ", fallos: " << stats.misses
+              << ", expulsiones: " << stats.evictions << "\n";
+
+    // Varios fragmentos: cada clave va siempre al mismo y cada uno tiene su LRU
+    LruCache<int, int> sharded(8, 4);
+    for (int key = 0; key < 12; ++key) {
+        sharded.put(key, key * key);
+    }
+    std::cout << "Fragmentos: " << sharded.shardCount() << "\n";
+    sharded.print();
+    std::cout << "Expulsiones: " << sharded.stats().evictions << "\n";
+
+    return 0;
+}
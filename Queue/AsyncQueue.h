@@ -0,0 +1,149 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "Executor.h"
+#include "GenericQueue.h"
+
+/*
+    Cola asíncrona para corrutinas de C++20 (requiere -std=c++20).
+
+    co_await queue.dequeue() devuelve el frente si hay elementos y, si no,
+    suspende la corrutina sin bloquear ningún hilo del sistema. Cuando llega un
+    enqueue, el valor se entrega directamente a la primera corrutina en espera
+    y esta se programa en el ejecutor de la cola para continuar.
+
+    Las corrutinas en espera forman una lista enlazada intrusiva: cada nodo es
+    el propio objeto awaiter, que vive en el marco de la corrutina suspendida,
+    así que esperar no reserva memoria.
+*/
+
+template <typename T>
+class AsyncQueue {
+public:
+    class DequeueAwaiter;
+
+    explicit AsyncQueue(Executor& executor)
+        : executor_(executor), waitersHead_(nullptr), waitersTail_(nullptr), closed_(false) {}
+
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+    // Añadir elemento al final. Devuelve false si la cola está cerrada.
+    bool enqueue(const T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_) {
+            return false;
+        }
+
+        if (waitersHead_ == nullptr) {
+            items_.enqueue(value);
+            return true;
+        }
+
+        // Hay una corrutina esperando: le entregamos el valor sin pasar por la cola
+        DequeueAwaiter* waiter = popWaiter();
+        waiter->result_.emplace(value);
+        lock.unlock();
+
+        executor_.post(waiter->handle_);
+        return true;
+    }
+
+    // co_await dequeue() devuelve std::optional<T>; std::nullopt si la cola se cerró vacía
+    DequeueAwaiter dequeue() {
+        return DequeueAwaiter(*this);
+    }
+
+    // Cierra la cola y reanuda todas las corrutinas en espera con std::nullopt
+    void close() {
+        DequeueAwaiter* waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            waiters = waitersHead_;
+            waitersHead_ = nullptr;
+            waitersTail_ = nullptr;
+        }
+
+        while (waiters != nullptr) {
+            DequeueAwaiter* next = waiters->next_;
+            executor_.post(waiters->handle_);
+            waiters = next;
+        }
+    }
+
+    std::size_t size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return items_.size();
+    }
+
+    class DequeueAwaiter {
+    public:
+        // Siempre pasamos por await_suspend, que decide bajo el cerrojo
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        // Devuelve false (no suspender) si había un elemento disponible
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard<std::mutex> lock(queue_.mutex_);
+            if (!queue_.items_.empty()) {
+                result_.emplace(std::move(queue_.items_.front()));
+                queue_.items_.dequeue();
+                return false;
+            }
+            if (queue_.closed_) {
+                return false;
+            }
+
+            handle_ = handle;
+            queue_.pushWaiter(this);
+            return true;
+        }
+
+        std::optional<T> await_resume() {
+            return std::move(result_);
+        }
+
+    private:
+        friend class AsyncQueue;
+
+        AsyncQueue& queue_;
+        std::coroutine_handle<> handle_;
+        std::optional<T> result_;
+        DequeueAwaiter* next_;
+
+        explicit DequeueAwaiter(AsyncQueue& queue) : queue_(queue), next_(nullptr) {}
+    };
+
+private:
+    Executor& executor_;
+    std::mutex mutex_;
+    GenericQueue<T> items_;
+    DequeueAwaiter* waitersHead_;   // Corrutinas en espera, en orden de llegada
+    DequeueAwaiter* waitersTail_;
+    bool closed_;
+
+    void pushWaiter(DequeueAwaiter* waiter) {
+        waiter->next_ = nullptr;
+        if (waitersTail_ == nullptr) {
+            waitersHead_ = waitersTail_ = waiter;
+        } else {
+            waitersTail_->next_ = waiter;
+            waitersTail_ = waiter;
+        }
+    }
+
+    DequeueAwaiter* popWaiter() {
+        DequeueAwaiter* waiter = waitersHead_;
+        waitersHead_ = waiter->next_;
+        if (waitersHead_ == nullptr) {
+            waitersTail_ = nullptr;
+        }
+        return waiter;
+    }
+};
@@ -0,0 +1,111 @@
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include "AsyncQueue.h"
+#include "Benchmark.h"
+#include "BlockingQueue.h"
+#include "Executor.h"
+
+// BENCHMARK: coste de un cambio de contexto con AsyncQueue (corrutinas) frente a BlockingQueue (hilos)
+//
+// Uso: ./AsyncQueueBenchmark [idas_y_vueltas]
+// Dos participantes se pasan un valor por dos colas (ping y pong). Cada ida y vuelta
+// implica dos esperas y dos despertares; el resultado se da por cambio de contexto.
+
+static void printSwitchCost(const std::string& name, std::size_t roundTrips, double nanoseconds) {
+    printResult(name, roundTrips, nanoseconds / static_cast<double>(2 * roundTrips));
+}
+
+Task pinger(AsyncQueue<long long>& ping, AsyncQueue<long long>& pong, std::size_t roundTrips,
+            BlockingQueue<long long>* done) {
+    long long checksum = 0;
+    for (std::size_t i = 0; i < roundTrips; ++i) {
+        ping.enqueue(static_cast<long long>(i));
+        std::optional<long long> value = co_await pong.dequeue();
+        checksum += *value;
+    }
+    ping.close();
+    if (done != nullptr) {
+        done->enqueue(checksum);
+    }
+    doNotOptimize(checksum);
+}
+
+Task ponger(AsyncQueue<long long>& ping, AsyncQueue<long long>& pong, BlockingQueue<long long>* done) {
+    while (std::optional<long long> value = co_await ping.dequeue()) {
+        pong.enqueue(*value);
+    }
+    if (done != nullptr) {
+        done->enqueue(0);
+    }
+}
+
+static void coroutinesSingleThread(std::size_t roundTrips) {
+    SingleThreadExecutor executor;
+    AsyncQueue<long long> ping(executor);
+    AsyncQueue<long long> pong(executor);
+
+    Stopwatch watch;
+    spawn(executor, ponger(ping, pong, nullptr));
+    spawn(executor, pinger(ping, pong, roundTrips, nullptr));
+    executor.run();
+    printSwitchCost("AsyncQueue (1 hilo)", roundTrips, watch.elapsedNanoseconds());
+}
+
+static void coroutinesThreadPool(std::size_t roundTrips, std::size_t threads) {
+    BlockingQueue<long long> done;
+    Stopwatch watch;
+    {
+        ThreadPoolExecutor executor(threads);
+        AsyncQueue<long long> ping(executor);
+        AsyncQueue<long long> pong(executor);
+
+        spawn(executor, ponger(ping, pong, &done));
+        spawn(executor, pinger(ping, pong, roundTrips, &done));
+
+        // Esperamos a que terminen las dos corrutinas antes de destruir las colas
+        long long result;
+        done.wait_dequeue(result);
+        done.wait_dequeue(result);
+    }
+    printSwitchCost("AsyncQueue (pool " + std::to_string(threads) + ")", roundTrips, watch.elapsedNanoseconds());
+}
+
+static void blockingThreads(std::size_t roundTrips) {
+    BlockingQueue<long long> ping;
+    BlockingQueue<long long> pong;
+
+    Stopwatch watch;
+    std::thread ponger([&]() {
+        long long value = 0;
+        while (ping.wait_dequeue(value)) {
+            pong.enqueue(value);
+        }
+    });
+
+    long long value = 0;
+    long long checksum = 0;
+    for (std::size_t i = 0; i < roundTrips; ++i) {
+        ping.enqueue(static_cast<long long>(i));
+        pong.wait_dequeue(value);
+        checksum += value;
+    }
+    ping.close();
+    ponger.join();
+    doNotOptimize(checksum);
+
+    printSwitchCost("BlockingQueue (2 hilos)", roundTrips, watch.elapsedNanoseconds());
+}
+
+int main(int argc, char** argv) {
+    std::size_t roundTrips = argOrDefault(argc, argv, 1, 200000);
+
+    std::cout << "Coste por cambio de contexto:\n\n";
+    coroutinesSingleThread(roundTrips);
+    coroutinesThreadPool(roundTrips, 1);
+    coroutinesThreadPool(roundTrips, 4);
+    blockingThreads(roundTrips);
+
+    return 0;
+}
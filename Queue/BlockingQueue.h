@@ -0,0 +1,135 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "GenericQueue.h"
+
+/*
+    Cola bloqueante sobre GenericQueue.
+
+    Un mutex protege la GenericQueue interna y una variable de condición
+    despierta a los consumidores cuando llegan datos, en lugar de que estos
+    consulten empty() en un bucle activo. drain_to mueve un lote entero de
+    elementos con un único despertar y una única adquisición del mutex.
+
+    close() marca el fin de la producción: los enqueue posteriores fallan, y
+    los consumidores terminan de vaciar la cola y después reciben false / 0.
+*/
+
+template <typename T>
+class BlockingQueue {
+public:
+    // Constructor por defecto
+    BlockingQueue() : closed_(false), waiters_(0) {}
+
+    // Una cola compartida entre hilos no se copia
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    // Añadir elemento al final. Devuelve false si la cola está cerrada.
+    bool enqueue(const T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_) {
+            return false;
+        }
+        queue_.enqueue(value);
+        bool wake = waiters_ > 0;
+        lock.unlock();
+
+        if (wake) {
+            notEmpty_.notify_one();
+        }
+        return true;
+    }
+
+    // Espera hasta que haya un elemento y lo extrae en out.
+    // Devuelve false si la cola está cerrada y vacía.
+    bool wait_dequeue(T& out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waitNotEmpty(lock);
+        if (queue_.empty()) {
+            return false;
+        }
+        takeFront(out);
+        return true;
+    }
+
+    // Como wait_dequeue, pero espera como mucho timeout.
+    // Devuelve false si vence el plazo o si la cola está cerrada y vacía.
+    template <typename Rep, typename Period>
+    bool wait_dequeue_for(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++waiters_;
+        notEmpty_.wait_for(lock, timeout, [this]() { return !queue_.empty() || closed_; });
+        --waiters_;
+
+        if (queue_.empty()) {
+            return false;
+        }
+        takeFront(out);
+        return true;
+    }
+
+    // Espera hasta que haya al menos un elemento y extrae hasta maxCount
+    // escribiéndolos en out. Devuelve cuántos ha extraído (0 si la cola está
+    // cerrada y vacía).
+    template <typename OutputIt>
+    std::size_t drain_to(OutputIt out, std::size_t maxCount) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waitNotEmpty(lock);
+
+        std::size_t count = 0;
+        while (count < maxCount && !queue_.empty()) {
+            *out = std::move(queue_.front());
+            ++out;
+            queue_.dequeue();
+            ++count;
+        }
+        return count;
+    }
+
+    // Cierra la cola y despierta a todos los consumidores que estén esperando
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        notEmpty_.notify_all();
+    }
+
+    bool closed() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    bool empty() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.empty();
+    }
+
+    std::size_t size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+private:
+    GenericQueue<T> queue_;
+    std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    bool closed_;
+    std::size_t waiters_;   // Consumidores dormidos: solo se notifica si hay alguno
+
+    void waitNotEmpty(std::unique_lock<std::mutex>& lock) {
+        ++waiters_;
+        notEmpty_.wait(lock, [this]() { return !queue_.empty() || closed_; });
+        --waiters_;
+    }
+
+    void takeFront(T& out) {
+        out = std::move(queue_.front());
+        queue_.dequeue();
+    }
+};
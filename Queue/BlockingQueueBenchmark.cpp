@@ -0,0 +1,112 @@
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Benchmark.h"
+#include "BlockingQueue.h"
+#include "GenericQueue.h"
+
+// BENCHMARK: consumo por lotes con BlockingQueue::drain_to
+//
+// Uso: ./BlockingQueueBenchmark [mensajes]
+// Un productor encola marcas de tiempo y un consumidor las retira:
+//  - "spin + mutex": el consumidor consulta empty() en bucle y extrae de uno en uno (situación de partida)
+//  - "drain_to(b)": el consumidor duerme hasta que hay datos y extrae lotes de hasta b elementos
+// Para cada caso se mide el rendimiento y la latencia extremo a extremo (p50 y p99).
+
+static long long nowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void printRow(const std::string& name, std::size_t messages, double seconds, double* latencies) {
+    double p50 = percentile(latencies, messages, 50.0);
+    double p99 = percentile(latencies, messages, 99.0);
+    std::cout << std::left << std::setw(18) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << messages / seconds / 1e6
+              << std::setw(14) << p50 / 1000.0
+              << std::setw(14) << p99 / 1000.0 << "\n";
+}
+
+// Consumidor que sondea una GenericQueue protegida con un mutex
+static void spinBaseline(std::size_t messages) {
+    GenericQueue<long long> queue;
+    std::mutex mutex;
+    double* latencies = new double[messages];
+
+    Stopwatch watch;
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < messages; ++i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.enqueue(nowNanoseconds());
+        }
+    });
+
+    std::size_t received = 0;
+    while (received < messages) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            lock.unlock();
+            std::this_thread::yield();
+            continue;
+        }
+        long long sent = queue.front();
+        queue.dequeue();
+        lock.unlock();
+        latencies[received++] = static_cast<double>(nowNanoseconds() - sent);
+    }
+    producer.join();
+
+    printRow("spin + mutex", messages, watch.elapsedSeconds(), latencies);
+    delete[] latencies;
+}
+
+static void drainBatches(std::size_t messages, std::size_t batch) {
+    BlockingQueue<long long> queue;
+    double* latencies = new double[messages];
+    long long* items = new long long[batch];
+
+    Stopwatch watch;
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < messages; ++i) {
+            queue.enqueue(nowNanoseconds());
+        }
+        queue.close();
+    });
+
+    std::size_t received = 0;
+    while (true) {
+        std::size_t n = queue.drain_to(items, batch);
+        if (n == 0) {
+            break;
+        }
+        long long now = nowNanoseconds();
+        for (std::size_t i = 0; i < n; ++i) {
+            latencies[received + i] = static_cast<double>(now - items[i]);
+        }
+        received += n;
+    }
+    producer.join();
+
+    if (received != messages) {
+        std::cerr << "ERROR: received " << received << " of " << messages << " messages\n";
+        std::exit(1);
+    }
+
+    printRow("drain_to(" + std::to_string(batch) + ")", messages, watch.elapsedSeconds(), latencies);
+    delete[] items;
+    delete[] latencies;
+}
+
+int main(int argc, char** argv) {
+    std::size_t messages = argOrDefault(argc, argv, 1, 2000000);
+
+    std::cout << "consumidor          Mops/s      p50 (us)      p99 (us)\n";
+    spinBaseline(messages);
+    for (std::size_t batch = 1; batch <= 1024; batch *= 4) {
+        drainBatches(messages, batch);
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BlockingQueue.h"
+#include "GenericQueue.h"
+
+/*
+    Ejecutores mínimos para corrutinas de C++20 (requiere -std=c++20).
+
+    Un ejecutor recibe corrutinas suspendidas (std::coroutine_handle<>) y
+    decide en qué hilo se reanudan:
+
+      - SingleThreadExecutor: las reanuda una detrás de otra en el hilo que
+        llama a run(). No usa cerrojos, así que post() solo puede llamarse
+        desde ese mismo hilo.
+      - ThreadPoolExecutor: un grupo fijo de hilos que toman las corrutinas
+        de una BlockingQueue.
+
+    Task es el tipo de corrutina más sencillo posible: empieza suspendida,
+    spawn() la entrega a un ejecutor y se destruye sola al terminar.
+*/
+
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    // Programa la reanudación de una corrutina suspendida
+    virtual void post(std::coroutine_handle<> handle) = 0;
+};
+
+class SingleThreadExecutor : public Executor {
+public:
+    void post(std::coroutine_handle<> handle) override {
+        ready_.enqueue(handle);
+    }
+
+    // Reanuda corrutinas hasta que no queda ninguna lista para ejecutarse
+    void run() {
+        while (!ready_.empty()) {
+            std::coroutine_handle<> handle = ready_.front();
+            ready_.dequeue();
+            handle.resume();
+        }
+    }
+
+private:
+    GenericQueue<std::coroutine_handle<>> ready_;
+};
+
+class ThreadPoolExecutor : public Executor {
+public:
+    explicit ThreadPoolExecutor(std::size_t threads) {
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this]() {
+                std::coroutine_handle<> handle;
+                while (ready_.wait_dequeue(handle)) {
+                    handle.resume();
+                }
+            });
+        }
+    }
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    // Destructor: termina las corrutinas pendientes y espera a los hilos
+    ~ThreadPoolExecutor() override {
+        ready_.close();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void post(std::coroutine_handle<> handle) override {
+        ready_.enqueue(handle);
+    }
+
+private:
+    BlockingQueue<std::coroutine_handle<>> ready_;
+    std::vector<std::thread> workers_;
+};
+
+// Corrutina sin valor de retorno que empieza suspendida y se destruye al terminar
+class Task {
+public:
+    struct promise_type {
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    // Una Task que nunca llegó a lanzarse se destruye sin ejecutarse
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Cede la corrutina: a partir de aquí su vida la gestiona quien la reanude
+    std::coroutine_handle<> release() {
+        return std::exchange(handle_, nullptr);
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+};
+
+// Lanza una Task en un ejecutor
+inline void spawn(Executor& executor, Task task) {
+    executor.post(task.release());
+}
@@ -0,0 +1,239 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "EpochReclamation.h"
+
+/*
+    Cola no acotada sin bloqueos (cola de Michael y Scott).
+
+    Es una lista enlazada simple con un nodo centinela al frente: head_ apunta
+    siempre a un nodo "vacío" cuyo siguiente es el primer elemento real, y
+    tail_ apunta al último nodo (o al penúltimo, si un enqueue todavía no ha
+    terminado de moverlo; cualquier hilo que lo detecte ayuda a avanzarlo).
+
+    A diferencia de GenericQueue, los enlaces son punteros crudos atómicos, sin
+    contadores de referencias. Los nodos que salen de la cola se retiran al
+    EpochDomain y, cuando es seguro, no se devuelven al sistema sino a una
+    reserva de nodos libres compartida por todos los hilos. Cada hilo que
+    encola se lleva de golpe todo lo que haya en ella a su propia reserva y
+    se sirve de ahí sin tocar memoria compartida; así el productor reutiliza
+    los nodos que retira el consumidor.
+*/
+
+template <typename T>
+class LockFreeQueue {
+public:
+    // Constructor por defecto: la cola vacía contiene solo el centinela
+    LockFreeQueue() {
+        Node* dummy = allocateNode();
+        head_.store(dummy, std::memory_order_relaxed);
+        tail_.store(dummy, std::memory_order_relaxed);
+    }
+
+    // Una cola compartida entre hilos no se copia
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // Destructor: ningún otro hilo puede estar usando la cola
+    ~LockFreeQueue() {
+        Node* current = head_.load(std::memory_order_relaxed);
+        Node* next = current->next.load(std::memory_order_relaxed);
+        delete current;   // El centinela no tiene valor construido
+
+        while (next != nullptr) {
+            current = next;
+            next = current->next.load(std::memory_order_relaxed);
+            current->value()->~T();
+            delete current;
+        }
+    }
+
+    // Añadir elemento al final
+    void enqueue(const T& value) {
+        Node* node = allocateNode();
+        new (node->value()) T(value);
+        link(node);
+    }
+
+    void enqueue(T&& value) {
+        Node* node = allocateNode();
+        new (node->value()) T(std::move(value));
+        link(node);
+    }
+
+    // Extrae el frente en out. Devuelve false si la cola está vacía.
+    bool try_dequeue(T& out) {
+        EpochGuard guard;
+
+        while (true) {
+            Node* head = head_.load(std::memory_order_acquire);
+            Node* tail = tail_.load(std::memory_order_acquire);
+            Node* next = head->next.load(std::memory_order_acquire);
+
+            if (head != head_.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (head == tail) {
+                if (next == nullptr) {
+                    return false;
+                }
+                // tail_ se ha quedado atrás: ayudamos a avanzarlo
+                tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            if (head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                // next es el nuevo centinela. Solo el hilo que gana el CAS toca su valor.
+                T* value = next->value();
+                out = std::move(*value);
+                value->~T();
+                EpochDomain::instance().retire(head, &recycleNode);
+                return true;
+            }
+        }
+    }
+
+    // Resultado instantáneo: otro hilo puede modificar la cola justo después
+    bool empty() const {
+        EpochGuard guard;
+        Node* head = head_.load(std::memory_order_acquire);
+        return head->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+    static constexpr std::size_t kMaxPooledNodes = 1024;
+
+    // El valor se guarda sin construir: el centinela no tiene valor
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    // Reserva de nodos libres de cada hilo. Es trivialmente destructible para
+    // que se pueda usar incluso mientras se destruyen otras variables del hilo.
+    struct NodePool {
+        Node* head;
+        bool closed;
+    };
+
+    // Reserva compartida: una pila de Treiber. Solo se saca de ella con
+    // exchange(nullptr), llevándose la pila entera, así que ningún CAS compara
+    // un nodo que haya podido salir y volver a entrar (ABA). count es un
+    // límite superior del número de nodos: se suma antes de meter uno.
+    // También es trivialmente destructible; lo que quede al terminar el
+    // programa no se libera.
+    struct SharedPool {
+        std::atomic<Node*> head;
+        std::atomic<std::size_t> count;
+    };
+
+    // Al terminar el hilo devuelve a la reserva compartida los nodos de la suya
+    struct NodePoolReleaser {
+        NodePool& pool;
+
+        ~NodePoolReleaser() {
+            while (pool.head != nullptr) {
+                Node* aux = pool.head;
+                pool.head = aux->next.load(std::memory_order_relaxed);
+                recycleNode(aux);
+            }
+            pool.closed = true;
+        }
+    };
+
+    alignas(kCacheLine) std::atomic<Node*> head_;
+    alignas(kCacheLine) std::atomic<Node*> tail_;
+
+    static NodePool& localPool() {
+        thread_local NodePool pool{nullptr, false};
+        thread_local NodePoolReleaser releaser{pool};
+        (void)releaser;
+        return pool;
+    }
+
+    static SharedPool& sharedPool() {
+        static SharedPool pool{{nullptr}, {0}};
+        return pool;
+    }
+
+    static Node* allocateNode() {
+        NodePool& pool = localPool();
+        if (pool.head == nullptr && !pool.closed) {
+            refill(pool);
+        }
+        if (pool.head != nullptr) {
+            Node* node = pool.head;
+            pool.head = node->next.load(std::memory_order_relaxed);
+            node->next.store(nullptr, std::memory_order_relaxed);
+            return node;
+        }
+        return new Node();
+    }
+
+    // Pasa a la reserva del hilo todos los nodos de la compartida
+    static void refill(NodePool& pool) {
+        SharedPool& shared = sharedPool();
+        if (shared.head.load(std::memory_order_relaxed) == nullptr) {
+            return;
+        }
+
+        Node* taken = shared.head.exchange(nullptr, std::memory_order_acquire);
+        std::size_t count = 0;
+        for (Node* current = taken; current != nullptr; current = current->next.load(std::memory_order_relaxed)) {
+            ++count;
+        }
+        shared.count.fetch_sub(count, std::memory_order_relaxed);
+        pool.head = taken;
+    }
+
+    // Lo llama el EpochDomain cuando ya ningún hilo puede leer el nodo
+    static void recycleNode(void* pointer) {
+        Node* node = static_cast<Node*>(pointer);
+        SharedPool& shared = sharedPool();
+        if (shared.count.fetch_add(1, std::memory_order_relaxed) >= kMaxPooledNodes) {
+            shared.count.fetch_sub(1, std::memory_order_relaxed);
+            delete node;
+            return;
+        }
+
+        Node* head = shared.head.load(std::memory_order_relaxed);
+        do {
+            node->next.store(head, std::memory_order_relaxed);
+        } while (!shared.head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Enlaza un nodo ya construido al final de la cola
+    void link(Node* node) {
+        EpochGuard guard;
+
+        while (true) {
+            Node* tail = tail_.load(std::memory_order_acquire);
+            Node* next = tail->next.load(std::memory_order_acquire);
+
+            if (tail != tail_.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (next != nullptr) {
+                // Otro enqueue enlazó su nodo pero no movió tail_: lo ayudamos
+                tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            Node* expected = nullptr;
+            if (tail->next.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+                tail_.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+};
@@ -0,0 +1,211 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+#include "GenericQueue.h"
+#include "LockFreeQueue.h"
+
+// BENCHMARK: LockFreeQueue (Michael-Scott + EBR + reserva de nodos) frente a GenericQueue
+//
+// Uso: ./LockFreeQueueBenchmark [elementos] [hilos_maximos]
+// 1. Coste por operación en un solo hilo: llenar y vaciar, y encolar/desencolar alternos.
+// 2. Varios hilos: LockFreeQueue frente a GenericQueue protegida con un mutex.
+// 3. Reservas de memoria por mensaje con un productor y un consumidor, contando
+//    cada operator new: los nodos que libera el consumidor tienen que volver
+//    al productor a través de la reserva compartida.
+
+class MutexQueue {
+public:
+    void enqueue(long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.enqueue(value);
+    }
+
+    bool try_dequeue(long long& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.dequeue();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    GenericQueue<long long> queue_;
+};
+
+// Adaptador para usar GenericQueue (sin hilos) con la misma interfaz
+class PlainQueue {
+public:
+    void enqueue(long long value) {
+        queue_.enqueue(value);
+    }
+
+    bool try_dequeue(long long& out) {
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.dequeue();
+        return true;
+    }
+
+private:
+    GenericQueue<long long> queue_;
+};
+
+template <typename Queue>
+void singleThread(const std::string& name, std::size_t n) {
+    long long checksum = 0;
+    long long value = 0;
+
+    {
+        Queue queue;
+        Stopwatch watch;
+        for (std::size_t i = 0; i < n; ++i) {
+            queue.enqueue(static_cast<long long>(i));
+        }
+        while (queue.try_dequeue(value)) {
+            checksum += value;
+        }
+        printResult(name + " llenar/vaciar", n, watch.elapsedNanoseconds() / static_cast<double>(2 * n));
+    }
+
+    {
+        Queue queue;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            queue.enqueue(static_cast<long long>(i));
+        }
+        Stopwatch watch;
+        for (std::size_t i = 0; i < n; ++i) {
+            queue.enqueue(static_cast<long long>(i));
+            queue.try_dequeue(value);
+            checksum += value;
+        }
+        printResult(name + " alterno", n, watch.elapsedNanoseconds() / static_cast<double>(2 * n));
+    }
+
+    doNotOptimize(checksum);
+}
+
+template <typename Queue>
+double multiThread(std::size_t threads, std::size_t messages) {
+    Queue queue;
+    std::size_t producers = threads / 2;
+    std::size_t consumers = threads - producers;
+    std::size_t perProducer = messages / producers;
+    std::size_t total = perProducer * producers;
+
+    std::atomic<std::size_t> consumed(0);
+    std::atomic<long long> consumedSum(0);
+    std::vector<std::thread> workers;
+
+    Stopwatch watch;
+    for (std::size_t p = 0; p < producers; ++p) {
+        workers.emplace_back([&, p]() {
+            for (std::size_t i = 0; i < perProducer; ++i) {
+                queue.enqueue(static_cast<long long>(p * perProducer + i));
+            }
+        });
+    }
+    for (std::size_t c = 0; c < consumers; ++c) {
+        workers.emplace_back([&]() {
+            long long value = 0;
+            long long sum = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_dequeue(value)) {
+                    sum += value;
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            consumedSum.fetch_add(sum);
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = watch.elapsedSeconds();
+
+    long long expected = static_cast<long long>(total) * static_cast<long long>(total - 1) / 2;
+    if (consumedSum.load() != expected) {
+        std::cerr << "ERROR: checksum mismatch\n";
+        std::exit(1);
+    }
+
+    return seconds * 1e9 / static_cast<double>(2 * total);
+}
+
+// Reservas de memoria por mensaje con un productor y un consumidor. El
+// productor no deja más de 'inFlight' mensajes sin consumir, como una
+// tubería en régimen estable en la que el consumidor da abasto.
+template <typename Queue>
+double allocationsPerMessage(std::size_t messages, std::size_t inFlight) {
+    Queue queue;
+    std::atomic<std::size_t> consumed(0);
+    long long sum = 0;
+    std::size_t before = allocationCount;
+
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < messages; ++i) {
+            while (i - consumed.load(std::memory_order_acquire) >= inFlight) {
+                std::this_thread::yield();
+            }
+            queue.enqueue(static_cast<long long>(i));
+        }
+    });
+    std::thread consumer([&]() {
+        long long value = 0;
+        for (std::size_t received = 0; received < messages;) {
+            if (queue.try_dequeue(value)) {
+                sum += value;
+                consumed.store(++received, std::memory_order_release);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    std::size_t allocations = allocationCount - before;
+    long long expected = static_cast<long long>(messages) * static_cast<long long>(messages - 1) / 2;
+    check(sum == expected, "checksum mismatch");
+    return static_cast<double>(allocations) / static_cast<double>(messages);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argOrDefault(argc, argv, 1, 2000000);
+    std::size_t maxThreads = argOrDefault(argc, argv, 2, 16);
+
+    std::cout << "########## UN HILO ##########\n\n";
+    singleThread<PlainQueue>("GenericQueue", n);
+    singleThread<LockFreeQueue<long long>>("LockFreeQueue", n);
+
+    std::cout << "\n########## VARIOS HILOS (ns por operacion) ##########\n\n";
+    std::cout << "hilos   GenericQueue + mutex   LockFreeQueue\n";
+    for (std::size_t threads = 2; threads <= maxThreads; threads *= 2) {
+        double mutexCost = multiThread<MutexQueue>(threads, n);
+        double lockFreeCost = multiThread<LockFreeQueue<long long>>(threads, n);
+        std::cout << std::setw(5) << threads
+                  << std::setw(23) << std::fixed << std::setprecision(2) << mutexCost
+                  << std::setw(16) << lockFreeCost << "\n";
+    }
+
+    std::cout << "\n########## RESERVAS POR MENSAJE (1 productor, 1 consumidor, 256 en vuelo) ##########\n\n";
+    std::cout << "GenericQueue + mutex   LockFreeQueue\n";
+    double mutexAllocations = allocationsPerMessage<MutexQueue>(n, 256);
+    double lockFreeAllocations = allocationsPerMessage<LockFreeQueue<long long>>(n, 256);
+    std::cout << std::setw(20) << std::fixed << std::setprecision(4) << mutexAllocations
+              << std::setw(16) << lockFreeAllocations << "\n";
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+#include "MinMaxStack.h"
+
+/*
+    Cola FIFO que responde min() y max() en O(1), pensada para ventanas
+    deslizantes (enqueue del dato nuevo, dequeue del que sale de la ventana).
+
+    Se construye con dos MinMaxStack: enqueue apila en in_ y dequeue desapila
+    de out_. Cuando out_ se vacía, se vuelca in_ entero sobre out_, lo que
+    invierte el orden y deja el elemento más antiguo en la cima. Cada
+    elemento se vuelca una sola vez, así que todas las operaciones son O(1)
+    amortizado. El mínimo y el máximo de la cola salen de combinar los de
+    las dos pilas.
+*/
+
+template <typename T, typename Compare = std::less<T>>
+class MinMaxQueue {
+public:
+    explicit MinMaxQueue(const Compare& compare = Compare())
+        : in_(compare), out_(compare), compare_(compare) {}
+
+    // Añadir elemento al final
+    void enqueue(const T& value) {
+        in_.push(value);
+    }
+
+    // Eliminar un elemento del principio
+    void dequeue() {
+        if (empty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        refill();
+        out_.pop();
+    }
+
+    // Acceder al elemento de delante
+    const T& front() {
+        if (empty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        refill();
+        return out_.top();
+    }
+
+    const T& min() const {
+        if (empty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        if (in_.empty()) {
+            return out_.min();
+        }
+        if (out_.empty()) {
+            return in_.min();
+        }
+        return compare_(out_.min(), in_.min()) ? out_.min() : in_.min();
+    }
+
+    const T& max() const {
+        if (empty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        if (in_.empty()) {
+            return out_.max();
+        }
+        if (out_.empty()) {
+            return in_.max();
+        }
+        return compare_(out_.max(), in_.max()) ? in_.max() : out_.max();
+    }
+
+    bool empty() const {
+        return in_.empty() && out_.empty();
+    }
+
+    std::size_t size() const {
+        return in_.size() + out_.size();
+    }
+
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty Queue]\n";
+            return;
+        }
+        std::cout << size() << " elementos (min " << min() << ", max " << max() << ")\n";
+    }
+
+private:
+    MinMaxStack<T, Compare> in_;    // Recibe los enqueue; el más reciente en la cima
+    MinMaxStack<T, Compare> out_;   // Sirve los dequeue; el más antiguo en la cima
+    Compare compare_;
+
+    // Si out_ está vacía, vuelca in_ sobre ella invirtiendo el orden
+    void refill() {
+        if (!out_.empty()) {
+            return;
+        }
+        while (!in_.empty()) {
+            out_.push(in_.top());
+            in_.pop();
+        }
+    }
+};
@@ -0,0 +1,134 @@
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include "Benchmark.h"
+#include "GenericQueue.h"
+#include "MinMaxQueue.h"
+
+// BENCHMARK: mínimo y máximo de una ventana deslizante con MinMaxQueue frente a reescanear una GenericQueue
+//
+// Uso: ./MinMaxQueueBenchmark [ticks] [exponente_maximo]
+// En cada tick entra un valor en la ventana, sale el más antiguo si la ventana está
+// llena y se consultan el mínimo y el máximo. Se mide el coste medio por tick para
+// ventanas de 10 a 10^exponente_maximo (10^6 por defecto). Reescanear cuesta O(ventana)
+// por tick, así que la referencia solo se mide hasta donde tarda un tiempo razonable.
+// Antes se comprueba que ambas versiones dan el mismo resultado, también con un
+// comparador propio (std::greater, que intercambia mínimo y máximo).
+
+// Ventana sobre una GenericQueue: mínimo y máximo recorriendo todos los elementos
+class RescanWindow {
+public:
+    void enqueue(int value) {
+        queue_.enqueue(value);
+    }
+
+    void dequeue() {
+        queue_.dequeue();
+    }
+
+    std::size_t size() const {
+        return queue_.size();
+    }
+
+    // GenericQueue no permite recorrerla: la rotamos entera para visitar cada elemento
+    void minMax(int& min, int& max) {
+        min = queue_.front();
+        max = queue_.front();
+        for (std::size_t i = 0; i < queue_.size(); ++i) {
+            int value = queue_.front();
+            queue_.dequeue();
+            min = value < min ? value : min;
+            max = value > max ? value : max;
+            queue_.enqueue(value);
+        }
+    }
+
+private:
+    GenericQueue<int> queue_;
+};
+
+static void verify(std::size_t window, std::size_t ticks) {
+    MinMaxQueue<int> fast;
+    MinMaxQueue<int, std::greater<int>> reversed;
+    RescanWindow slow;
+    Random random(window);
+
+    for (std::size_t t = 0; t < ticks; ++t) {
+        int value = static_cast<int>(random.next(1000000));
+        fast.enqueue(value);
+        reversed.enqueue(value);
+        slow.enqueue(value);
+        if (slow.size() > window) {
+            check(fast.front() == reversed.front(), "front() mismatch");
+            fast.dequeue();
+            reversed.dequeue();
+            slow.dequeue();
+        }
+
+        int min;
+        int max;
+        slow.minMax(min, max);
+        check(fast.min() == min && fast.max() == max, "MinMaxQueue disagrees with rescanning");
+        check(reversed.min() == max && reversed.max() == min, "custom comparator is not honored");
+        check(fast.size() == slow.size(), "size() mismatch");
+    }
+}
+
+// Mínimo + máximo de la ventana, para acumular en la suma de control
+static long long sample(MinMaxQueue<int>& window) {
+    return static_cast<long long>(window.min()) + window.max();
+}
+
+static long long sample(RescanWindow& window) {
+    int min;
+    int max;
+    window.minMax(min, max);
+    return static_cast<long long>(min) + max;
+}
+
+template <typename Window>
+static double timeWindow(Window& window, std::size_t windowSize, std::size_t ticks, long long& checksum) {
+    Random random(12345);
+    Stopwatch watch;
+    for (std::size_t t = 0; t < ticks; ++t) {
+        window.enqueue(static_cast<int>(random.next(1000000)));
+        if (window.size() > windowSize) {
+            window.dequeue();
+        }
+        checksum += sample(window);
+    }
+    return watch.elapsedNanoseconds() / static_cast<double>(ticks);
+}
+
+int main(int argc, char** argv) {
+    std::size_t ticks = argOrDefault(argc, argv, 1, 10000000);
+    std::size_t maxExp = argOrDefault(argc, argv, 2, 6);
+
+    verify(1, 1000);
+    verify(7, 20000);
+    verify(1000, 20000);
+    std::cout << "Verificacion frente a reescaneo: OK\n\n";
+
+    std::cout << "ventana                       ticks      ns/tick\n";
+    for (std::size_t exp = 1; exp <= maxExp; ++exp) {
+        std::size_t windowSize = powerOfTen(exp);
+        long long checksum = 0;
+
+        MinMaxQueue<int> window;
+        printResult("MinMaxQueue w=10^" + std::to_string(exp), ticks,
+                    timeWindow(window, windowSize, ticks, checksum));
+
+        // La referencia hace windowSize pasos por tick: limitamos el trabajo total
+        std::size_t rescanTicks = 50000000 / windowSize;
+        if (rescanTicks >= 10000) {
+            rescanTicks = rescanTicks < ticks ? rescanTicks : ticks;
+            RescanWindow rescan;
+            printResult("reescaneo   w=10^" + std::to_string(exp), rescanTicks,
+                        timeWindow(rescan, windowSize, rescanTicks, checksum));
+        }
+        doNotOptimize(checksum);
+    }
+
+    return 0;
+}
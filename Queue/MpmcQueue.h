@@ -0,0 +1,170 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/*
+    Cola acotada de múltiples productores y múltiples consumidores (MPMC).
+
+    Sigue el diseño de Dmitry Vyukov: un buffer circular en el que cada celda
+    lleva su propio número de secuencia. Para la celda de la posición pos:
+
+      sequence == pos              → la celda está libre para el productor de pos
+      sequence == pos + 1          → la celda tiene un dato para el consumidor de pos
+      sequence == pos + capacidad  → el consumidor ya la ha vaciado para la vuelta siguiente
+
+    Productores y consumidores reservan su posición con un CAS sobre
+    enqueuePos_ / dequeuePos_ y después solo tocan su celda, de modo que los
+    hilos de un mismo lado únicamente compiten por un contador.
+*/
+
+template <typename T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(std::size_t capacity)
+        : capacity_(roundUpToPowerOfTwo(capacity)), mask_(capacity_ - 1), buffer_(new Cell[capacity_]),
+          enqueuePos_(0), dequeuePos_(0) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            buffer_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Una cola compartida entre hilos no se copia
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // Destructor: destruye los elementos que quedan y libera el buffer
+    ~MpmcQueue() {
+        std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        std::size_t end = enqueuePos_.load(std::memory_order_relaxed);
+        for (; pos != end; ++pos) {
+            buffer_[pos & mask_].value()->~T();
+        }
+        delete[] buffer_;
+    }
+
+    // Inserta al final. Devuelve false si la cola está llena.
+    bool try_enqueue(const T& value) {
+        std::size_t pos;
+        Cell* cell = reserveEnqueue(pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        new (cell->value()) T(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Extrae el frente en out. Devuelve false si la cola está vacía.
+    bool try_dequeue(T& out) {
+        std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &buffer_[pos & mask_];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* value = cell->value();
+        out = std::move(*value);
+        value->~T();
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    // Inserta al final esperando mientras la cola esté llena
+    void enqueue(const T& value) {
+        while (!try_enqueue(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Extrae y devuelve el frente esperando mientras la cola esté vacía
+    T dequeue() {
+        T value;
+        while (!try_dequeue(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+
+    // Valores aproximados si se consultan mientras otros hilos operan
+    bool empty() const {
+        return size() == 0;
+    }
+
+    std::size_t size() const {
+        std::size_t dequeued = dequeuePos_.load(std::memory_order_acquire);
+        std::size_t enqueued = enqueuePos_.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    std::size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    Cell* const buffer_;
+
+    alignas(kCacheLine) std::atomic<std::size_t> enqueuePos_;
+    alignas(kCacheLine) std::atomic<std::size_t> dequeuePos_;
+    char padding_[kCacheLine - sizeof(std::atomic<std::size_t>)];
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        if (value < 2) {
+            throw std::invalid_argument("MpmcQueue capacity must be at least 2");
+        }
+        std::size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Reserva la siguiente posición de escritura en pos; nullptr si la cola está llena
+    Cell* reserveEnqueue(std::size_t& pos) {
+        pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell* cell = &buffer_[pos & mask_];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
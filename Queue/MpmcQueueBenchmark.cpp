@@ -0,0 +1,115 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "GenericQueue.h"
+#include "MpmcQueue.h"
+
+// BENCHMARK: MpmcQueue (Vyukov) frente a GenericQueue protegida con un mutex
+//
+// Uso: ./MpmcQueueBenchmark [mensajes] [hilos_maximos]
+// Para cada número de hilos se lanza la mitad como productores y la mitad como
+// consumidores. Cada mensaje es un identificador único; al terminar se comprueba
+// que cada identificador se ha recibido exactamente una vez (prueba de estrés).
+
+class MutexQueue {
+public:
+    bool try_enqueue(const std::size_t& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.enqueue(value);
+        return true;
+    }
+
+    bool try_dequeue(std::size_t& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.dequeue();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    GenericQueue<std::size_t> queue_;
+};
+
+template <typename Queue>
+double run(Queue& queue, std::size_t threads, std::size_t messages) {
+    std::size_t producers = threads > 1 ? threads / 2 : 1;
+    std::size_t consumers = threads > 1 ? threads - producers : 1;
+    std::size_t perProducer = messages / producers;
+    std::size_t total = perProducer * producers;
+
+    // received[id] cuenta cuántas veces ha llegado cada identificador
+    std::atomic<unsigned char>* received = new std::atomic<unsigned char>[total];
+    for (std::size_t i = 0; i < total; ++i) {
+        received[i].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<std::size_t> consumed(0);
+    std::vector<std::thread> workers;
+
+    Stopwatch watch;
+    for (std::size_t p = 0; p < producers; ++p) {
+        workers.emplace_back([&, p]() {
+            for (std::size_t i = 0; i < perProducer; ++i) {
+                std::size_t id = p * perProducer + i;
+                while (!queue.try_enqueue(id)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < consumers; ++c) {
+        workers.emplace_back([&]() {
+            std::size_t id;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_dequeue(id)) {
+                    received[id].fetch_add(1, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = watch.elapsedSeconds();
+
+    for (std::size_t i = 0; i < total; ++i) {
+        if (received[i].load(std::memory_order_relaxed) != 1) {
+            std::cerr << "ERROR: message " << i << " received " << int(received[i].load()) << " times\n";
+            std::exit(1);
+        }
+    }
+    delete[] received;
+
+    return static_cast<double>(total) / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    std::size_t messages = argOrDefault(argc, argv, 1, 4000000);
+    std::size_t maxThreads = argOrDefault(argc, argv, 2, 32);
+
+    std::cout << "hilos   GenericQueue + mutex   MpmcQueue(1024)   (Mops/s)\n";
+    for (std::size_t threads = 2; threads <= maxThreads; threads *= 2) {
+        MutexQueue mutexQueue;
+        double mutexRate = run(mutexQueue, threads, messages);
+
+        MpmcQueue<std::size_t> mpmcQueue(1024);
+        double mpmcRate = run(mpmcQueue, threads, messages);
+
+        std::cout << std::setw(5) << threads
+                  << std::setw(23) << std::fixed << std::setprecision(2) << mutexRate
+                  << std::setw(18) << mpmcRate << "\n";
+    }
+    std::cout << "Prueba de estres: todos los mensajes recibidos exactamente una vez\n";
+
+    return 0;
+}
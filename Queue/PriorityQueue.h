@@ -0,0 +1,427 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/*
+    Cola de prioridad sobre un montículo d-ario guardado en un array contiguo.
+
+    top() devuelve el elemento que va primero según Compare: con std::less
+    (por defecto) es el menor, como en una cola de tareas por plazo. Cada
+    nodo tiene D hijos; con D = 4 u 8 el árbol es más bajo y los hijos de un
+    nodo caen en la misma línea de caché, a cambio de más comparaciones al
+    bajar.
+
+    push() devuelve un Handle con el que luego se puede adelantar un elemento
+    (decrease_key) o quitarlo de en medio (erase) en O(log_D n). Para ello
+    cada entrada del montículo lleva un identificador y positions_[id] dice en
+    qué posición del array está. Los identificadores libres se encadenan en
+    el propio positions_, así que no hace falta otra estructura.
+
+    Un Handle deja de ser válido cuando su elemento sale de la cola; su
+    identificador puede reutilizarse en el siguiente push.
+*/
+
+template <typename T, typename Compare = std::less<T>, std::size_t D = 4>
+class PriorityQueue {
+    static_assert(D >= 2, "PriorityQueue requires D >= 2");
+
+public:
+    class Handle {
+    public:
+        Handle() : id_(std::numeric_limits<std::uint32_t>::max()) {}
+
+        bool operator==(const Handle& other) const {
+            return id_ == other.id_;
+        }
+
+        bool operator!=(const Handle& other) const {
+            return id_ != other.id_;
+        }
+
+    private:
+        friend class PriorityQueue;
+
+        std::uint32_t id_;
+
+        explicit Handle(std::uint32_t id) : id_(id) {}
+    };
+
+    // Constructor por defecto
+    explicit PriorityQueue(const Compare& compare = Compare())
+        : heap_(nullptr), positions_(nullptr), size_(0), capacity_(0),
+          idCount_(0), freeId_(kNone), compare_(compare) {}
+
+    // Construcción en bloque en O(n)
+    template <typename InputIt>
+    PriorityQueue(InputIt first, InputIt last, const Compare& compare = Compare())
+        : PriorityQueue(compare) {
+        heapify(first, last);
+    }
+
+    // Constructor de copia: conserva la forma del montículo, así que los Handle siguen valiendo en la copia
+    PriorityQueue(const PriorityQueue& other)
+        : heap_(nullptr), positions_(nullptr), size_(0), capacity_(0),
+          idCount_(0), freeId_(kNone), compare_(other.compare_) {
+        copy(other);
+    }
+
+    PriorityQueue(PriorityQueue&& other) noexcept
+        : heap_(other.heap_), positions_(other.positions_), size_(other.size_), capacity_(other.capacity_),
+          idCount_(other.idCount_), freeId_(other.freeId_), compare_(std::move(other.compare_)) {
+        other.heap_ = nullptr;
+        other.positions_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        other.idCount_ = 0;
+        other.freeId_ = kNone;
+    }
+
+    // Sobrecarga de operador =
+    PriorityQueue& operator=(const PriorityQueue& other) {
+        if (this != &other) {
+            freeHeap();
+            compare_ = other.compare_;
+            copy(other);
+        }
+        return *this;
+    }
+
+    PriorityQueue& operator=(PriorityQueue&& other) noexcept {
+        if (this != &other) {
+            freeHeap();
+            heap_ = other.heap_;
+            positions_ = other.positions_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            idCount_ = other.idCount_;
+            freeId_ = other.freeId_;
+            compare_ = std::move(other.compare_);
+            other.heap_ = nullptr;
+            other.positions_ = nullptr;
+            other.size_ = 0;
+            other.capacity_ = 0;
+            other.idCount_ = 0;
+            other.freeId_ = kNone;
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~PriorityQueue() {
+        freeHeap();
+    }
+
+    Handle push(const T& value) {
+        return pushEntry(T(value));
+    }
+
+    Handle push(T&& value) {
+        return pushEntry(std::move(value));
+    }
+
+    // Sustituye el contenido por [first, last) en O(n). Los Handle anteriores dejan de valer.
+    template <typename InputIt>
+    void heapify(InputIt first, InputIt last) {
+        heapify(first, last, static_cast<Handle*>(nullptr));
+    }
+
+    // Igual, pero escribe en handles el Handle de cada elemento en el orden de entrada
+    template <typename InputIt, typename OutputIt>
+    void heapify(InputIt first, InputIt last, OutputIt handles) {
+        clear();
+        for (; first != last; ++first) {
+            Index id = acquireId();
+            if (size_ == capacity_) {
+                grow();
+            }
+            new (entry(size_)) Entry{*first, id};
+            positions_[id] = static_cast<Index>(size_);
+            ++size_;
+            writeHandle(handles, Handle(id));
+        }
+
+        // Floyd: hundimos cada nodo interno empezando por el último
+        if (size_ > 1) {
+            for (std::size_t i = (size_ - 2) / D + 1; i > 0; --i) {
+                siftDown(i - 1);
+            }
+        }
+    }
+
+    const T& top() const {
+        if (empty()) {
+            throw std::underflow_error("Priority queue is empty");
+        }
+        return entry(0)->value;
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::underflow_error("Priority queue is empty");
+        }
+        removeAt(0);
+    }
+
+    // Adelanta un elemento: value no puede ir detrás del valor actual
+    void decrease_key(Handle handle, const T& value) {
+        std::size_t position = positionOf(handle);
+        Entry* current = entry(position);
+        if (compare_(current->value, value)) {
+            throw std::invalid_argument("New key is worse than the current one");
+        }
+        current->value = value;
+        siftUp(position);
+    }
+
+    // Quita un elemento cualquiera de la cola
+    void erase(Handle handle) {
+        removeAt(positionOf(handle));
+    }
+
+    bool contains(Handle handle) const {
+        return handle.id_ < idCount_ && positions_[handle.id_] < size_ &&
+               entry(positions_[handle.id_])->id == handle.id_;
+    }
+
+    const T& value(Handle handle) const {
+        return entry(positionOf(handle))->value;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+    // Vacía la cola sin liberar la memoria reservada
+    void clear() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            entry(i)->~Entry();
+        }
+        size_ = 0;
+        idCount_ = 0;
+        freeId_ = kNone;
+    }
+
+    // Muestra el array del montículo por niveles
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty Priority Queue]\n";
+            return;
+        }
+
+        std::cout << "Top -> ";
+        for (std::size_t i = 0; i < size_; ++i) {
+            std::cout << entry(i)->value;
+            if (i + 1 < size_) {
+                std::cout << " | ";
+            }
+        }
+        std::cout << "\n";
+    }
+
+private:
+    // Identificadores y posiciones de 32 bits: con T pequeños una entrada ocupa la mitad
+    using Index = std::uint32_t;
+
+    struct Entry {
+        T value;
+        Index id;
+    };
+
+    static constexpr Index kNone = std::numeric_limits<Index>::max();
+
+    unsigned char* heap_;      // Array de capacity_ entradas, construidas solo las size_ primeras
+    Index* positions_;         // Por identificador: posición en el montículo, o siguiente id libre
+    std::size_t size_;
+    std::size_t capacity_;     // Capacidad de heap_ y de positions_
+    std::size_t idCount_;      // Identificadores entregados alguna vez (en uso o libres)
+    Index freeId_;             // Cabeza de la lista de identificadores libres
+    Compare compare_;
+
+    Entry* entry(std::size_t index) const {
+        return std::launder(reinterpret_cast<Entry*>(heap_) + index);
+    }
+
+    static std::size_t parent(std::size_t index) {
+        return (index - 1) / D;
+    }
+
+    template <typename OutputIt>
+    static void writeHandle(OutputIt& handles, Handle handle) {
+        *handles = handle;
+        ++handles;
+    }
+
+    static void writeHandle(Handle*& handles, Handle handle) {
+        if (handles != nullptr) {
+            *handles++ = handle;
+        }
+    }
+
+    std::size_t positionOf(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("Invalid priority queue handle");
+        }
+        return positions_[handle.id_];
+    }
+
+    Handle pushEntry(T&& value) {
+        Index id = acquireId();
+        if (size_ == capacity_) {
+            grow();
+        }
+        new (entry(size_)) Entry{std::move(value), id};
+        positions_[id] = static_cast<Index>(size_);
+        ++size_;
+        siftUp(size_ - 1);
+        return Handle(id);
+    }
+
+    Index acquireId() {
+        if (freeId_ != kNone) {
+            Index id = freeId_;
+            freeId_ = positions_[id];
+            return id;
+        }
+        if (idCount_ == capacity_) {
+            grow();
+        }
+        return static_cast<Index>(idCount_++);
+    }
+
+    void releaseId(Index id) {
+        positions_[id] = freeId_;
+        freeId_ = id;
+    }
+
+    // Quita la entrada de la posición index rellenando el hueco con la última
+    void removeAt(std::size_t index) {
+        releaseId(entry(index)->id);
+        --size_;
+        if (index != size_) {
+            *entry(index) = std::move(*entry(size_));
+            positions_[entry(index)->id] = static_cast<Index>(index);
+            entry(size_)->~Entry();
+            if (index > 0 && compare_(entry(index)->value, entry(parent(index))->value)) {
+                siftUp(index);
+            } else {
+                siftDown(index);
+            }
+        } else {
+            entry(size_)->~Entry();
+        }
+    }
+
+    // Sube la entrada dejando un hueco que se desplaza, en vez de intercambiar en cada nivel
+    void siftUp(std::size_t index) {
+        Entry moving = std::move(*entry(index));
+        while (index > 0) {
+            std::size_t up = parent(index);
+            if (!compare_(moving.value, entry(up)->value)) {
+                break;
+            }
+            place(index, std::move(*entry(up)));
+            index = up;
+        }
+        place(index, std::move(moving));
+    }
+
+    void siftDown(std::size_t index) {
+        Entry moving = std::move(*entry(index));
+        while (true) {
+            std::size_t first = index * D + 1;
+            if (first >= size_) {
+                break;
+            }
+            std::size_t last = first + D < size_ ? first + D : size_;
+
+            // El mejor de los hasta D hijos
+            std::size_t best = first;
+            for (std::size_t child = first + 1; child < last; ++child) {
+                if (compare_(entry(child)->value, entry(best)->value)) {
+                    best = child;
+                }
+            }
+            if (!compare_(entry(best)->value, moving.value)) {
+                break;
+            }
+            place(index, std::move(*entry(best)));
+            index = best;
+        }
+        place(index, std::move(moving));
+    }
+
+    void place(std::size_t index, Entry&& source) {
+        *entry(index) = std::move(source);
+        positions_[entry(index)->id] = static_cast<Index>(index);
+    }
+
+    void grow() {
+        std::size_t capacity = capacity_ == 0 ? 16 : capacity_ * 2;
+        if (capacity > kNone) {
+            if (capacity_ == kNone) {
+                throw std::length_error("Priority queue is full");
+            }
+            capacity = kNone;
+        }
+        unsigned char* heap = static_cast<unsigned char*>(
+            ::operator new(capacity * sizeof(Entry), std::align_val_t(alignof(Entry))));
+        Index* positions = new Index[capacity];
+
+        Entry* target = std::launder(reinterpret_cast<Entry*>(heap));
+        for (std::size_t i = 0; i < size_; ++i) {
+            new (target + i) Entry(std::move(*entry(i)));
+            entry(i)->~Entry();
+        }
+        for (std::size_t i = 0; i < idCount_; ++i) {
+            positions[i] = positions_[i];
+        }
+
+        releaseStorage();
+        heap_ = heap;
+        positions_ = positions;
+        capacity_ = capacity;
+    }
+
+    void releaseStorage() {
+        if (heap_ != nullptr) {
+            ::operator delete(heap_, std::align_val_t(alignof(Entry)));
+        }
+        delete[] positions_;
+    }
+
+    void freeHeap() {
+        clear();
+        releaseStorage();
+        heap_ = nullptr;
+        positions_ = nullptr;
+        capacity_ = 0;
+    }
+
+    void copy(const PriorityQueue& other) {
+        if (other.capacity_ > 0) {
+            heap_ = static_cast<unsigned char*>(
+                ::operator new(other.capacity_ * sizeof(Entry), std::align_val_t(alignof(Entry))));
+            positions_ = new Index[other.capacity_];
+            capacity_ = other.capacity_;
+        }
+        for (std::size_t i = 0; i < other.size_; ++i) {
+            new (entry(i)) Entry(*other.entry(i));
+            ++size_;
+        }
+        for (std::size_t i = 0; i < other.idCount_; ++i) {
+            positions_[i] = other.positions_[i];
+        }
+        idCount_ = other.idCount_;
+        freeId_ = other.freeId_;
+    }
+};
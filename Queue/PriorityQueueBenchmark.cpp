@@ -0,0 +1,151 @@
+#include <cstdint>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+#include "Benchmark.h"
+#include "PriorityQueue.h"
+
+// BENCHMARK: PriorityQueue (montículo d-ario) con D = 2, 4 y 8
+//
+// Uso: ./PriorityQueueBenchmark [operaciones] [tamaño_inicial]
+// 1. Construcción: heapify en O(n) frente a n push sucesivos.
+// 2. Mezcla de push/pop aleatorios (50/50) sobre una cola con tamaño_inicial elementos.
+// 3. Mezcla con decrease_key: push, pop y adelantos de elementos al azar.
+// std::priority_queue se muestra como referencia en la prueba 2, y la suma de los
+// valores extraídos debe coincidir con la suya. Al final de las pruebas 2 y 3 se
+// vacía la cola comprobando que los valores salen en orden.
+
+// Generador xorshift: la misma secuencia para todas las variantes
+static std::uint32_t* randomKeys(std::size_t n, std::uint64_t seed) {
+    std::uint32_t* keys = new std::uint32_t[n];
+    Random random(seed);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = static_cast<std::uint32_t>(random.nextRaw());
+    }
+    return keys;
+}
+
+template <std::size_t D>
+static void buildBenchmark(const std::uint32_t* keys, std::size_t n) {
+    Stopwatch watch;
+    PriorityQueue<std::uint32_t, std::less<std::uint32_t>, D> bulk(keys, keys + n);
+    printResult("heapify (D=" + std::to_string(D) + ")", n, watch.elapsedNanoseconds() / n);
+
+    watch.reset();
+    PriorityQueue<std::uint32_t, std::less<std::uint32_t>, D> pushed;
+    for (std::size_t i = 0; i < n; ++i) {
+        pushed.push(keys[i]);
+    }
+    printResult("n push (D=" + std::to_string(D) + ")", n, watch.elapsedNanoseconds() / n);
+
+    check(bulk.top() == pushed.top(), "heapify and push disagree on top()");
+}
+
+// Mezcla push/pop con la misma secuencia aleatoria para cualquier cola
+template <typename Queue>
+static std::uint64_t mixedOperations(Queue& queue, std::size_t operations, std::uint64_t seed) {
+    Random random(seed);
+    std::uint64_t checksum = 0;
+    for (std::size_t i = 0; i < operations; ++i) {
+        std::uint64_t r = random.nextRaw();
+        if ((r & 1) == 0 || queue.empty()) {
+            queue.push(static_cast<std::uint32_t>(r >> 32));
+        } else {
+            checksum += queue.top();
+            queue.pop();
+        }
+    }
+    return checksum;
+}
+
+template <typename Queue>
+static void checkDrainOrder(Queue& queue) {
+    std::uint32_t previous = 0;
+    while (!queue.empty()) {
+        check(queue.top() >= previous, "pop order is not monotonic");
+        previous = queue.top();
+        queue.pop();
+    }
+}
+
+template <std::size_t D>
+static std::uint64_t mixedBenchmark(const std::uint32_t* keys, std::size_t initial, std::size_t operations) {
+    PriorityQueue<std::uint32_t, std::less<std::uint32_t>, D> queue(keys, keys + initial);
+    Stopwatch watch;
+    std::uint64_t checksum = mixedOperations(queue, operations, 42);
+    printResult("push/pop (D=" + std::to_string(D) + ")", operations, watch.elapsedNanoseconds() / operations);
+    checkDrainOrder(queue);
+    return checksum;
+}
+
+template <std::size_t D>
+static void decreaseKeyBenchmark(std::size_t initial, std::size_t operations) {
+    using Queue = PriorityQueue<std::uint32_t, std::less<std::uint32_t>, D>;
+    Queue queue;
+    std::vector<typename Queue::Handle> handles;
+    handles.reserve(initial + operations);
+
+    Random random(7);
+    for (std::size_t i = 0; i < initial; ++i) {
+        handles.push_back(queue.push(static_cast<std::uint32_t>(random.nextRaw() >> 32)));
+    }
+
+    Stopwatch watch;
+    for (std::size_t i = 0; i < operations; ++i) {
+        std::uint64_t r = random.nextRaw();
+        switch (r % 3) {
+        case 0:
+            handles.push_back(queue.push(static_cast<std::uint32_t>(r >> 32)));
+            break;
+        case 1:
+            if (!queue.empty()) {
+                queue.pop();
+            }
+            break;
+        default: {
+            // Adelanta un elemento al azar si sigue en la cola
+            typename Queue::Handle handle = handles[(r >> 8) % handles.size()];
+            if (queue.contains(handle)) {
+                queue.decrease_key(handle, queue.value(handle) / 2);
+            }
+            break;
+        }
+        }
+    }
+    printResult("+decrease_key (D=" + std::to_string(D) + ")", operations, watch.elapsedNanoseconds() / operations);
+    checkDrainOrder(queue);
+}
+
+int main(int argc, char** argv) {
+    std::size_t operations = argOrDefault(argc, argv, 1, 10000000);
+    std::size_t initial = argOrDefault(argc, argv, 2, 1000000);
+    // La prueba 3 adelanta elementos ya insertados: necesita al menos uno
+    check(initial > 0, "initial size must be at least 1");
+
+    std::uint32_t* keys = randomKeys(initial, 12345);
+
+    std::cout << "Construccion de " << initial << " elementos (ns por elemento):\n\n";
+    buildBenchmark<2>(keys, initial);
+    buildBenchmark<4>(keys, initial);
+    buildBenchmark<8>(keys, initial);
+
+    std::cout << "\n" << operations << " operaciones push/pop sobre " << initial << " elementos (ns por operacion):\n\n";
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>, std::greater<std::uint32_t>> reference(
+        keys, keys + initial);
+    Stopwatch watch;
+    std::uint64_t expected = mixedOperations(reference, operations, 42);
+    printResult("std::priority_queue", operations, watch.elapsedNanoseconds() / operations);
+
+    check(mixedBenchmark<2>(keys, initial, operations) == expected, "D=2 checksum mismatch");
+    check(mixedBenchmark<4>(keys, initial, operations) == expected, "D=4 checksum mismatch");
+    check(mixedBenchmark<8>(keys, initial, operations) == expected, "D=8 checksum mismatch");
+
+    std::cout << "\nMezcla push/pop/decrease_key (ns por operacion):\n\n";
+    decreaseKeyBenchmark<2>(initial, operations);
+    decreaseKeyBenchmark<4>(initial, operations);
+    decreaseKeyBenchmark<8>(initial, operations);
+
+    delete[] keys;
+    return 0;
+}
@@ -0,0 +1,322 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/*
+    Cola FIFO con un presupuesto fijo de memoria que desborda a disco.
+
+    Los elementos se agrupan en segmentos de segmentCapacity() posiciones.
+    La cola, de delante hacia atrás, se compone de:
+
+      - cabeza: segmentos en memoria de los que lee dequeue();
+      - medio: segmentos llenos guardados en un fichero en el que solo se
+        añade al final y del que se lee en orden;
+      - cola: el segmento en memoria en el que escribe enqueue().
+
+    Mientras quepa en el presupuesto, un segmento lleno pasa directamente a
+    la cabeza sin copiarse. Cuando no cabe, o cuando ya hay segmentos en el
+    fichero (para no adelantarlos), se escribe al final del fichero. Al
+    agotarse la cabeza se vuelven a cargar segmentos del fichero, tantos
+    como quepan, con lecturas secuenciales. Cuando el fichero se vacía se
+    vuelve a escribir desde el principio.
+
+    Con una sobrecarga sostenida el fichero puede no vaciarse nunca. Para que
+    no crezca sin límite, cuando la parte ya leída ocupa al menos tanto como
+    la pendiente (y como el presupuesto), la pendiente se copia al principio
+    y el fichero se recorta: su tamaño queda acotado por unas dos veces lo
+    que hay en él más dos presupuestos, y cada byte pendiente se copia como
+    mucho una vez por cada byte leído.
+
+    Los elementos se guardan en el fichero byte a byte, así que T debe ser
+    trivialmente copiable.
+*/
+
+template <typename T>
+class SpillingQueue {
+    static_assert(std::is_trivially_copyable<T>::value, "SpillingQueue requires a trivially copyable T");
+
+public:
+    // memoryBudget en bytes. Si spillPath está vacío se crea un fichero en el directorio temporal.
+    explicit SpillingQueue(std::size_t memoryBudget, const std::string& spillPath = "")
+        : headFirst_(nullptr), headLast_(nullptr), tail_(nullptr), spare_(nullptr),
+          headCount_(0), spilledSegments_(0), readOffset_(0), writeOffset_(0), size_(0),
+          memoryBudget_(memoryBudget) {
+        segmentCapacity_ = memoryBudget / (kSegmentsInBudget * sizeof(T));
+        if (segmentCapacity_ == 0) {
+            segmentCapacity_ = 1;
+        }
+        maxSegments_ = memoryBudget / (segmentCapacity_ * sizeof(T));
+        if (maxSegments_ < 2) {
+            maxSegments_ = 2;
+        }
+
+        path_ = spillPath.empty() ? defaultPath() : spillPath;
+        file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file_.is_open()) {
+            throw std::runtime_error("Could not open spill file: " + path_);
+        }
+    }
+
+    // La cola es dueña de su fichero: no se copia
+    SpillingQueue(const SpillingQueue&) = delete;
+    SpillingQueue& operator=(const SpillingQueue&) = delete;
+
+    // Destructor: libera los segmentos y borra el fichero
+    ~SpillingQueue() {
+        while (headFirst_ != nullptr) {
+            Segment* aux = headFirst_;
+            headFirst_ = headFirst_->next;
+            freeSegment(aux);
+        }
+        freeSegment(tail_);
+        freeSegment(spare_);
+
+        file_.close();
+        std::remove(path_.c_str());
+    }
+
+    // Añadir elemento al final
+    void enqueue(const T& value) {
+        if (tail_ == nullptr) {
+            tail_ = acquireSegment();
+        } else if (tail_->end == segmentCapacity_) {
+            sealTail();
+        }
+
+        new (tail_->items + tail_->end) T(value);
+        ++tail_->end;
+        ++size_;
+    }
+
+    // Eliminar un elemento del principio
+    void dequeue() {
+        if (empty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+
+        Segment* segment = frontSegment();
+        ++segment->begin;
+        --size_;
+
+        if (segment->begin == segment->end) {
+            if (segment == tail_) {
+                tail_->begin = 0;
+                tail_->end = 0;
+            } else {
+                headFirst_ = headFirst_->next;
+                if (headFirst_ == nullptr) {
+                    headLast_ = nullptr;
+                }
+                --headCount_;
+                releaseSegment(segment);
+            }
+        }
+    }
+
+    // Acceder al elemento de delante (puede cargar segmentos del fichero)
+    T& front() {
+        if (empty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        Segment* segment = frontSegment();
+        return segment->items[segment->begin];
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Número exacto de elementos, estén en memoria o en el fichero
+    std::size_t size() const {
+        return size_;
+    }
+
+    // Elementos que están ahora mismo en el fichero
+    std::size_t spilledSize() const {
+        return spilledSegments_ * segmentCapacity_;
+    }
+
+    std::size_t memoryBudget() const {
+        return memoryBudget_;
+    }
+
+    std::size_t segmentCapacity() const {
+        return segmentCapacity_;
+    }
+
+    const std::string& spillPath() const {
+        return path_;
+    }
+
+private:
+    // Segmentos en los que se reparte el presupuesto de memoria
+    static constexpr std::size_t kSegmentsInBudget = 8;
+
+    struct Segment {
+        T* items;            // segmentCapacity_ posiciones sin construir
+        std::size_t begin;   // Primer elemento pendiente
+        std::size_t end;     // Una posición después del último
+        Segment* next;
+    };
+
+    Segment* headFirst_;           // Segmentos en memoria por delante del fichero
+    Segment* headLast_;
+    Segment* tail_;                // Segmento en el que escribe enqueue()
+    Segment* spare_;               // Último segmento liberado, reservado para reutilizar
+    std::size_t headCount_;
+    std::size_t spilledSegments_;  // Segmentos llenos pendientes de leer en el fichero
+    std::streamoff readOffset_;
+    std::streamoff writeOffset_;
+    std::size_t size_;
+    std::size_t memoryBudget_;
+    std::size_t segmentCapacity_;
+    std::size_t maxSegments_;      // Segmentos en memoria permitidos, contando la cola
+
+    std::string path_;
+    std::fstream file_;
+
+    static std::string defaultPath() {
+        static std::size_t counter = 0;
+        std::uint64_t stamp = static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+        std::string name = "spilling-queue-" + std::to_string(stamp) + "-" + std::to_string(counter++) + ".bin";
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    std::size_t segmentBytes() const {
+        return segmentCapacity_ * sizeof(T);
+    }
+
+    Segment* acquireSegment() {
+        Segment* segment = spare_;
+        if (segment != nullptr) {
+            spare_ = nullptr;
+        } else {
+            segment = new Segment;
+            segment->items = static_cast<T*>(::operator new(segmentBytes(), std::align_val_t(alignof(T))));
+        }
+        segment->begin = 0;
+        segment->end = 0;
+        segment->next = nullptr;
+        return segment;
+    }
+
+    // Solo se guarda en reserva si cabe en el presupuesto junto a la cabeza y la cola
+    void releaseSegment(Segment* segment) {
+        if (spare_ == nullptr && headCount_ + 2 <= maxSegments_) {
+            spare_ = segment;
+        } else {
+            freeSegment(segment);
+        }
+    }
+
+    void freeSegment(Segment* segment) {
+        if (segment != nullptr) {
+            ::operator delete(segment->items, std::align_val_t(alignof(T)));
+            delete segment;
+        }
+    }
+
+    void appendHead(Segment* segment) {
+        segment->next = nullptr;
+        if (headLast_ == nullptr) {
+            headFirst_ = headLast_ = segment;
+        } else {
+            headLast_->next = segment;
+            headLast_ = segment;
+        }
+        ++headCount_;
+    }
+
+    // La cola está llena: pasa a la cabeza si cabe y no adelanta al fichero; si no, va al fichero
+    void sealTail() {
+        if (spilledSegments_ == 0 && headCount_ + 2 <= maxSegments_) {
+            appendHead(tail_);
+            tail_ = acquireSegment();
+            return;
+        }
+
+        file_.seekp(writeOffset_);
+        file_.write(reinterpret_cast<const char*>(tail_->items), static_cast<std::streamsize>(segmentBytes()));
+        if (!file_) {
+            throw std::runtime_error("Could not write spill file: " + path_);
+        }
+        writeOffset_ += static_cast<std::streamoff>(segmentBytes());
+        ++spilledSegments_;
+
+        tail_->begin = 0;
+        tail_->end = 0;
+    }
+
+    // Copia los segmentos pendientes al principio del fichero y lo recorta.
+    // Se llama con la cabeza vacía, así que el segmento auxiliar cabe en el presupuesto.
+    void compactFile() {
+        Segment* buffer = acquireSegment();
+        std::streamsize bytes = static_cast<std::streamsize>(segmentBytes());
+        std::streamoff from = readOffset_;
+        std::streamoff to = 0;
+
+        while (from < writeOffset_) {
+            file_.seekg(from);
+            file_.read(reinterpret_cast<char*>(buffer->items), bytes);
+            file_.seekp(to);
+            file_.write(reinterpret_cast<const char*>(buffer->items), bytes);
+            if (!file_) {
+                releaseSegment(buffer);
+                throw std::runtime_error("Could not compact spill file: " + path_);
+            }
+            from += bytes;
+            to += bytes;
+        }
+        releaseSegment(buffer);
+
+        file_.flush();
+        std::filesystem::resize_file(path_, static_cast<std::uintmax_t>(to));
+        readOffset_ = 0;
+        writeOffset_ = to;
+    }
+
+    // Recarga la cabeza desde el fichero con tantos segmentos como quepan
+    void loadSpilled() {
+        std::streamoff pending = writeOffset_ - readOffset_;
+        if (readOffset_ >= pending && readOffset_ >= static_cast<std::streamoff>(maxSegments_ * segmentBytes())) {
+            compactFile();
+        }
+
+        file_.seekg(readOffset_);
+        while (spilledSegments_ > 0 && headCount_ + 1 < maxSegments_) {
+            Segment* segment = acquireSegment();
+            file_.read(reinterpret_cast<char*>(segment->items), static_cast<std::streamsize>(segmentBytes()));
+            if (!file_) {
+                freeSegment(segment);
+                throw std::runtime_error("Could not read spill file: " + path_);
+            }
+            segment->end = segmentCapacity_;
+            appendHead(segment);
+            readOffset_ += static_cast<std::streamoff>(segmentBytes());
+            --spilledSegments_;
+        }
+
+        // Fichero consumido: se vuelve a escribir desde el principio
+        if (spilledSegments_ == 0) {
+            readOffset_ = 0;
+            writeOffset_ = 0;
+        }
+    }
+
+    // Segmento que contiene el primer elemento. Requiere que la cola no esté vacía.
+    Segment* frontSegment() {
+        if (headFirst_ == nullptr && spilledSegments_ > 0) {
+            loadSpilled();
+        }
+        return headFirst_ != nullptr ? headFirst_ : tail_;
+    }
+};
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include "Benchmark.h"
+#include "GenericQueue.h"
+#include "SpillingQueue.h"
+
+// BENCHMARK: SpillingQueue (presupuesto de memoria + fichero) frente a GenericQueue en memoria
+//
+// Uso: ./SpillingQueueBenchmark [presupuesto_MiB] [factor] [operaciones_sostenidas]
+// El conjunto de trabajo es factor veces el presupuesto (10x por defecto):
+// 1. Ráfaga: se encola todo el conjunto de trabajo y después se vacía.
+// 2. Sostenido: con el conjunto de trabajo encolado, se alternan enqueue y dequeue.
+// Se comprueba que los registros salen en orden FIFO y que size() es exacto en todo momento.
+// En la fase sostenida el fichero de SpillingQueue nunca se vacía: se comprueba
+// además que su tamaño no pasa de dos veces el conjunto de trabajo más dos presupuestos.
+
+struct Record {
+    std::uint64_t sequence;
+    std::uint64_t payload[7];
+};
+
+static Record makeRecord(std::uint64_t sequence) {
+    Record record;
+    record.sequence = sequence;
+    for (std::uint64_t i = 0; i < 7; ++i) {
+        record.payload[i] = sequence * 31 + i;
+    }
+    return record;
+}
+
+static void printThroughput(const std::string& name, std::size_t records, double seconds) {
+    double megabytes = static_cast<double>(records * sizeof(Record)) / (1024.0 * 1024.0);
+    std::cout << std::left << std::setw(34) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(2) << records / seconds / 1e6
+              << std::setw(12) << megabytes / seconds << "\n";
+}
+
+// Bytes que ocupa en disco la cola (GenericQueue no usa ninguno)
+static std::uintmax_t diskBytes(const SpillingQueue<Record>& queue) {
+    return std::filesystem::file_size(queue.spillPath());
+}
+
+static std::uintmax_t diskBytes(const GenericQueue<Record>&) {
+    return 0;
+}
+
+// Ejecuta las dos fases con cualquier cola que tenga enqueue/front/dequeue/size
+template <typename Queue>
+static void run(const std::string& name, Queue& queue, std::size_t workingSet, std::size_t operations,
+                std::uintmax_t maxDiskBytes) {
+    std::uint64_t nextIn = 0;
+    std::uint64_t nextOut = 0;
+    std::uintmax_t peakDiskBytes = 0;
+
+    Stopwatch watch;
+    for (std::size_t i = 0; i < workingSet; ++i) {
+        queue.enqueue(makeRecord(nextIn++));
+    }
+    check(queue.size() == workingSet, "size() is wrong after the burst");
+    printThroughput(name + " rafaga (enqueue)", workingSet, watch.elapsedSeconds());
+
+    // Sostenido: el conjunto de trabajo se mantiene encolado
+    watch.reset();
+    for (std::size_t i = 0; i < operations; ++i) {
+        queue.enqueue(makeRecord(nextIn++));
+        check(queue.front().sequence == nextOut, "FIFO order broken");
+        queue.dequeue();
+        ++nextOut;
+        if (i % 4096 == 0) {
+            peakDiskBytes = std::max(peakDiskBytes, diskBytes(queue));
+        }
+    }
+    check(queue.size() == workingSet, "size() is wrong after the sustained phase");
+    printThroughput(name + " sostenido", operations, watch.elapsedSeconds());
+    check(peakDiskBytes <= maxDiskBytes, "spill file keeps growing under sustained load");
+
+    watch.reset();
+    while (queue.size() > 0) {
+        const Record& record = queue.front();
+        check(record.sequence == nextOut && record.payload[6] == nextOut * 31 + 6, "record corrupted");
+        queue.dequeue();
+        ++nextOut;
+    }
+    check(nextOut == nextIn, "records lost");
+    printThroughput(name + " rafaga (dequeue)", workingSet, watch.elapsedSeconds());
+}
+
+int main(int argc, char** argv) {
+    std::size_t budgetMiB = argOrDefault(argc, argv, 1, 16);
+    std::size_t factor = argOrDefault(argc, argv, 2, 10);
+    std::size_t budget = budgetMiB * 1024 * 1024;
+    std::size_t workingSet = factor * budget / sizeof(Record);
+    std::size_t operations = argOrDefault(argc, argv, 3, 2 * workingSet);
+
+    std::cout << "Presupuesto: " << budgetMiB << " MiB, conjunto de trabajo: " << workingSet
+              << " registros de " << sizeof(Record) << " bytes (" << factor * budgetMiB << " MiB)\n\n";
+    std::cout << "cola                                   Mops/s       MiB/s\n";
+
+    {
+        SpillingQueue<Record> spilling(budget);
+        std::uintmax_t maxDiskBytes = 2 * workingSet * sizeof(Record) + 2 * budget;
+        run("SpillingQueue", spilling, workingSet, operations, maxDiskBytes);
+    }
+
+    // Referencia sin límite de memoria: cada nodo añade el control block del shared_ptr
+    {
+        GenericQueue<Record> memory;
+        run("GenericQueue", memory, workingSet, operations, 0);
+    }
+
+    return 0;
+}
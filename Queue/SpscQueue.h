@@ -0,0 +1,167 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/*
+    Cola acotada de un productor y un consumidor (SPSC) sobre un buffer circular.
+
+    El productor solo escribe tail_ y el consumidor solo escribe head_, así que
+    basta con cargas acquire / almacenamientos release para sincronizarlos, sin
+    cerrojos ni operaciones read-modify-write. Cada índice vive en su propia
+    línea de caché, y cada lado guarda una copia local del índice del otro
+    (cachedHead_ / cachedTail_) para no leer la línea compartida en cada
+    operación.
+
+    La capacidad se redondea a la siguiente potencia de dos para poder calcular
+    la posición con una máscara (index & mask_) en vez de un módulo.
+
+    Solo un hilo puede llamar a los métodos try_enqueue* y solo otro hilo a los
+    métodos try_dequeue*.
+*/
+
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : capacity_(roundUpToPowerOfTwo(capacity)),
+          mask_(capacity_ - 1),
+          buffer_(static_cast<T*>(::operator new(capacity_ * sizeof(T), std::align_val_t(alignof(T))))),
+          head_(0), cachedTail_(0), tail_(0), cachedHead_(0) {}
+
+    // Una cola compartida entre hilos no se copia
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Destructor: destruye los elementos que quedan y libera el buffer
+    ~SpscQueue() {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (std::size_t i = head; i != tail; ++i) {
+            buffer_[i & mask_].~T();
+        }
+        ::operator delete(buffer_, std::align_val_t(alignof(T)));
+    }
+
+    // Productor: inserta al final. Devuelve false si la cola está llena.
+    bool try_enqueue(const T& value) {
+        return emplace(value);
+    }
+
+    bool try_enqueue(T&& value) {
+        return emplace(std::move(value));
+    }
+
+    // Productor: inserta hasta count elementos de items. Devuelve cuántos ha insertado.
+    // El índice compartido se publica una sola vez para todo el lote.
+    std::size_t try_enqueue_bulk(const T* items, std::size_t count) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t free = capacity_ - (tail - cachedHead_);
+        if (free < count) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cachedHead_);
+        }
+
+        std::size_t n = count < free ? count : free;
+        for (std::size_t i = 0; i < n; ++i) {
+            new (&buffer_[(tail + i) & mask_]) T(items[i]);
+        }
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // Consumidor: extrae el frente en out. Devuelve false si la cola está vacía.
+    bool try_dequeue(T& out) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return false;
+            }
+        }
+
+        T& slot = buffer_[head & mask_];
+        out = std::move(slot);
+        slot.~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumidor: extrae hasta maxCount elementos en out. Devuelve cuántos ha extraído.
+    std::size_t try_dequeue_bulk(T* out, std::size_t maxCount) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t available = cachedTail_ - head;
+        if (available < maxCount) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            available = cachedTail_ - head;
+        }
+
+        std::size_t n = maxCount < available ? maxCount : available;
+        for (std::size_t i = 0; i < n; ++i) {
+            T& slot = buffer_[(head + i) & mask_];
+            out[i] = std::move(slot);
+            slot.~T();
+        }
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    // Valores aproximados si se consultan mientras el otro hilo opera
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    T* const buffer_;
+
+    // Lado del consumidor
+    alignas(kCacheLine) std::atomic<std::size_t> head_;
+    std::size_t cachedTail_;
+
+    // Lado del productor
+    alignas(kCacheLine) std::atomic<std::size_t> tail_;
+    std::size_t cachedHead_;
+
+    // Relleno para que tail_ no comparta línea con lo que venga detrás del objeto
+    char padding_[kCacheLine - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)];
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        if (value == 0) {
+            throw std::invalid_argument("Queue capacity must be greater than zero");
+        }
+        std::size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    template <typename U>
+    bool emplace(U&& value) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ == capacity_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ == capacity_) {
+                return false;
+            }
+        }
+
+        new (&buffer_[tail & mask_]) T(std::forward<U>(value));
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+};
@@ -0,0 +1,141 @@
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Benchmark.h"
+#include "GenericQueue.h"
+#include "SpscQueue.h"
+
+// BENCHMARK: SpscQueue (buffer circular sin bloqueos) frente a GenericQueue protegida con un mutex
+//
+// Uso: ./SpscQueueBenchmark [mensajes]
+// Un hilo productor envía marcas de tiempo y un hilo consumidor las recibe.
+// Se mide el rendimiento (Mops/s) y la latencia extremo a extremo (p50 y p99).
+
+// GenericQueue protegida por un mutex (situación de partida)
+class MutexQueue {
+public:
+    bool try_enqueue(long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.enqueue(value);
+        return true;
+    }
+
+    bool try_dequeue(long long& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.dequeue();
+        return true;
+    }
+
+    std::size_t try_enqueue_bulk(const long long* items, std::size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t i = 0; i < count; ++i) {
+            queue_.enqueue(items[i]);
+        }
+        return count;
+    }
+
+    std::size_t try_dequeue_bulk(long long* out, std::size_t maxCount) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t n = 0;
+        while (n < maxCount && !queue_.empty()) {
+            out[n++] = queue_.front();
+            queue_.dequeue();
+        }
+        return n;
+    }
+
+private:
+    std::mutex mutex_;
+    GenericQueue<long long> queue_;
+};
+
+static long long nowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// batch == 1 usa try_enqueue/try_dequeue; batch > 1 usa las variantes por lotes
+template <typename Queue>
+void run(const std::string& name, Queue& queue, std::size_t messages, std::size_t batch) {
+    double* latencies = new double[messages];
+
+    Stopwatch watch;
+    std::thread producer([&]() {
+        long long* items = new long long[batch];
+        std::size_t sent = 0;
+        while (sent < messages) {
+            std::size_t n = messages - sent < batch ? messages - sent : batch;
+            long long now = nowNanoseconds();
+            for (std::size_t i = 0; i < n; ++i) {
+                items[i] = now;
+            }
+
+            std::size_t done = 0;
+            while (done < n) {
+                std::size_t pushed = batch == 1 ? (queue.try_enqueue(items[0]) ? 1 : 0)
+                                                : queue.try_enqueue_bulk(items + done, n - done);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                done += pushed;
+            }
+            sent += n;
+        }
+        delete[] items;
+    });
+
+    std::thread consumer([&]() {
+        long long* items = new long long[batch];
+        std::size_t received = 0;
+        while (received < messages) {
+            std::size_t n = batch == 1 ? (queue.try_dequeue(items[0]) ? 1 : 0)
+                                       : queue.try_dequeue_bulk(items, batch);
+            if (n == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            long long now = nowNanoseconds();
+            for (std::size_t i = 0; i < n; ++i) {
+                latencies[received + i] = static_cast<double>(now - items[i]);
+            }
+            received += n;
+        }
+        delete[] items;
+    });
+
+    producer.join();
+    consumer.join();
+    double seconds = watch.elapsedSeconds();
+
+    double p50 = percentile(latencies, messages, 50.0);
+    double p99 = percentile(latencies, messages, 99.0);
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::setw(8) << batch
+              << std::setw(12) << std::fixed << std::setprecision(2) << messages / seconds / 1e6
+              << std::setw(14) << p50 / 1000.0
+              << std::setw(14) << p99 / 1000.0 << "\n";
+
+    delete[] latencies;
+}
+
+int main(int argc, char** argv) {
+    std::size_t messages = argOrDefault(argc, argv, 1, 5000000);
+
+    std::cout << "cola                       lote    Mops/s   p50 (us)      p99 (us)\n";
+    const std::size_t batches[] = {1, 64};
+    for (std::size_t batch : batches) {
+        MutexQueue mutexQueue;
+        run("GenericQueue + mutex", mutexQueue, messages, batch);
+
+        SpscQueue<long long> spscQueue(4096);
+        run("SpscQueue(4096)", spscQueue, messages, batch);
+    }
+
+    return 0;
+}
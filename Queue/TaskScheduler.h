@@ -0,0 +1,294 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "GenericQueue.h"
+#include "WorkStealingDeque.h"
+
+/*
+    Planificador fork/join sobre un grupo fijo de hilos con robo de trabajo.
+
+    Cada hilo trabajador tiene su propio WorkStealingDeque de tareas:
+
+      - Las tareas que crea un trabajador van al fondo de su deque y él mismo
+        las saca en orden LIFO, que es el que mejor aprovecha la caché.
+      - Un trabajador sin tareas roba de la cima del deque de otro, elegido al
+        azar: se lleva las más antiguas, que suelen ser las más grandes.
+      - Las tareas que llegan desde fuera del grupo de hilos entran por una
+        cola de inyección (GenericQueue protegida con un mutex).
+
+    Un hilo sin nada que hacer lo reintenta unas cuantas veces cediendo la CPU
+    y después se duerme en una variable de condición. Solo se notifica cuando
+    hay algún hilo dormido, así que en plena carga crear una tarea no toca
+    ningún mutex.
+
+    TaskGroup agrupa tareas para esperar a que terminen. Si quien espera es un
+    trabajador, ejecuta otras tareas mientras tanto en lugar de bloquearse, de
+    modo que las recursiones fork/join no agotan los hilos.
+
+    Las tareas no deben lanzar excepciones: si lo hacen, se llama a
+    std::terminate.
+*/
+
+class TaskScheduler {
+public:
+    class TaskGroup;
+
+    explicit TaskScheduler(std::size_t threads = defaultThreads())
+        : threads_(threads > 0 ? threads : 1), workers_(new Worker[threads_]),
+          injectedCount_(0), sleepers_(0), stopping_(false) {
+        for (std::size_t i = 0; i < threads_; ++i) {
+            workers_[i].owner = this;
+            workers_[i].thread = std::thread([this, i]() {
+                workerLoop(workers_[i]);
+            });
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // Destructor: termina las tareas pendientes y espera a los hilos
+    ~TaskScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stopping_.store(true, std::memory_order_seq_cst);
+        }
+        wakeCondition_.notify_all();
+        for (std::size_t i = 0; i < threads_; ++i) {
+            workers_[i].thread.join();
+        }
+        delete[] workers_;
+    }
+
+    // Lanza una tarea independiente, sin forma de esperarla
+    template <typename F>
+    void submit(F&& function) {
+        schedule(new Job<typename std::decay<F>::type>(std::forward<F>(function), nullptr));
+    }
+
+    std::size_t threadCount() const {
+        return threads_;
+    }
+
+    static std::size_t defaultThreads() {
+        std::size_t cores = std::thread::hardware_concurrency();
+        return cores > 0 ? cores : 1;
+    }
+
+    // Conjunto de tareas que se pueden esperar juntas. El destructor espera.
+    class TaskGroup {
+    public:
+        explicit TaskGroup(TaskScheduler& scheduler) : scheduler_(scheduler), pending_(0) {}
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        ~TaskGroup() {
+            wait();
+        }
+
+        template <typename F>
+        void spawn(F&& function) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            scheduler_.schedule(new Job<typename std::decay<F>::type>(std::forward<F>(function), this));
+        }
+
+        // Espera a que terminen todas las tareas del grupo, ayudando mientras tanto
+        void wait() {
+            Worker* self = scheduler_.currentWorker();
+            while (pending_.load(std::memory_order_acquire) > 0) {
+                JobBase* job = scheduler_.findJob(self);
+                if (job != nullptr) {
+                    scheduler_.execute(job);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        friend class TaskScheduler;
+
+        TaskScheduler& scheduler_;
+        std::atomic<std::size_t> pending_;
+    };
+
+private:
+    struct JobBase {
+        TaskGroup* group;
+
+        explicit JobBase(TaskGroup* taskGroup) : group(taskGroup) {}
+        virtual ~JobBase() = default;
+        virtual void run() noexcept = 0;
+    };
+
+    template <typename F>
+    struct Job : JobBase {
+        F function;
+
+        template <typename G>
+        Job(G&& callable, TaskGroup* taskGroup) : JobBase(taskGroup), function(std::forward<G>(callable)) {}
+
+        void run() noexcept override {
+            function();
+        }
+    };
+
+    struct Worker {
+        WorkStealingDeque<JobBase*> deque;
+        std::thread thread;
+        TaskScheduler* owner = nullptr;
+    };
+
+    // Intentos de buscar trabajo cediendo la CPU antes de dormirse
+    static constexpr int kSpins = 32;
+
+    std::size_t threads_;
+    Worker* workers_;
+
+    std::mutex injectedMutex_;
+    GenericQueue<JobBase*> injected_;            // Tareas que llegan desde fuera del grupo
+    std::atomic<std::size_t> injectedCount_;     // Permite consultar la cola sin tomar el mutex
+
+    std::mutex sleepMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic<std::size_t> sleepers_;
+    std::atomic<bool> stopping_;
+
+    // Trabajador que ejecuta el hilo actual, o nullptr si no es de este planificador
+    Worker* currentWorker() const {
+        Worker* worker = currentWorkerSlot();
+        return worker != nullptr && worker->owner == this ? worker : nullptr;
+    }
+
+    static Worker*& currentWorkerSlot() {
+        thread_local Worker* worker = nullptr;
+        return worker;
+    }
+
+    // Generador xorshift propio de cada hilo, para elegir a quién robar
+    static std::size_t nextRandom() {
+        thread_local std::uint64_t state =
+            std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<std::size_t>(state);
+    }
+
+    void schedule(JobBase* job) {
+        Worker* self = currentWorker();
+        if (self != nullptr) {
+            self->deque.push(job);
+        } else {
+            std::lock_guard<std::mutex> lock(injectedMutex_);
+            injected_.enqueue(job);
+            injectedCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Emparejado con la barrera de workerLoop: o el hilo que se va a dormir
+        // ve la tarea, o nosotros vemos que está dormido y lo despertamos
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            wakeCondition_.notify_one();
+        }
+    }
+
+    // Busca una tarea: primero la propia, luego la cola de inyección y por último roba
+    JobBase* findJob(Worker* self) {
+        if (self != nullptr) {
+            if (std::optional<JobBase*> job = self->deque.pop()) {
+                return *job;
+            }
+        }
+
+        if (injectedCount_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(injectedMutex_);
+            if (!injected_.empty()) {
+                JobBase* job = injected_.front();
+                injected_.dequeue();
+                injectedCount_.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        std::size_t start = nextRandom() % threads_;
+        for (std::size_t i = 0; i < threads_; ++i) {
+            Worker& victim = workers_[(start + i) % threads_];
+            if (&victim == self) {
+                continue;
+            }
+            if (std::optional<JobBase*> job = victim.deque.steal()) {
+                return *job;
+            }
+        }
+        return nullptr;
+    }
+
+    // Hay trabajo visible en algún sitio (puede haber falsos positivos)
+    bool hasWork() const {
+        if (injectedCount_.load(std::memory_order_relaxed) > 0) {
+            return true;
+        }
+        for (std::size_t i = 0; i < threads_; ++i) {
+            if (!workers_[i].deque.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void execute(JobBase* job) {
+        TaskGroup* group = job->group;
+        job->run();
+        delete job;
+        if (group != nullptr) {
+            group->pending_.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void workerLoop(Worker& self) {
+        currentWorkerSlot() = &self;
+        int idle = 0;
+
+        while (true) {
+            JobBase* job = findJob(&self);
+            if (job != nullptr) {
+                execute(job);
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < kSpins) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            sleepers_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex_);
+                if (!hasWork()) {
+                    if (stopping_.load(std::memory_order_relaxed)) {
+                        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+                        break;
+                    }
+                    wakeCondition_.wait(lock);
+                }
+            }
+            sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            idle = 0;
+        }
+
+        currentWorkerSlot() = nullptr;
+    }
+};
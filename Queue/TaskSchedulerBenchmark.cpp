@@ -0,0 +1,197 @@
+#include <atomic>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "TaskScheduler.h"
+#include "WorkStealingDeque.h"
+
+// BENCHMARK: planificador fork/join con robo de trabajo (TaskScheduler + WorkStealingDeque)
+//
+// Uso: ./TaskSchedulerBenchmark [n_fib] [profundidad_arbol] [hilos_maximos]
+// 1. Prueba de estrés del deque: el propietario inserta y extrae mientras varios
+//    ladrones roban; cada elemento debe salir exactamente una vez.
+// 2. fib(n) recursivo en paralelo (por debajo de un umbral se calcula en serie).
+// 3. Suma de un árbol binario completo recorriendo cada subárbol en una tarea.
+// Para cada número de hilos se muestra el tiempo y la aceleración frente a la versión en serie.
+
+static void stressDeque(std::size_t items, std::size_t thieves) {
+    WorkStealingDeque<std::size_t> deque(16);   // Pequeño para forzar que crezca
+    std::atomic<unsigned char>* seen = new std::atomic<unsigned char>[items];
+    for (std::size_t i = 0; i < items; ++i) {
+        seen[i].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<bool> done(false);
+    std::vector<std::thread> workers;
+
+    for (std::size_t t = 0; t < thieves; ++t) {
+        workers.emplace_back([&]() {
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (std::optional<std::size_t> item = deque.steal()) {
+                    seen[*item].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    // El propietario alterna ráfagas de push con algunos pop
+    std::size_t next = 0;
+    while (next < items) {
+        for (std::size_t i = 0; i < 64 && next < items; ++i) {
+            deque.push(next++);
+        }
+        for (std::size_t i = 0; i < 16; ++i) {
+            if (std::optional<std::size_t> item = deque.pop()) {
+                seen[*item].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    while (std::optional<std::size_t> item = deque.pop()) {
+        seen[*item].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (std::size_t i = 0; i < items; ++i) {
+        check(seen[i].load(std::memory_order_relaxed) == 1, "deque item lost or duplicated");
+    }
+    delete[] seen;
+    std::cout << "Deque: " << items << " elementos, " << thieves << " ladrones, OK\n";
+}
+
+// ---------- fib ----------
+
+static long long serialFib(int n) {
+    return n < 2 ? n : serialFib(n - 1) + serialFib(n - 2);
+}
+
+static long long parallelFib(TaskScheduler& scheduler, int n, int cutoff) {
+    if (n < cutoff) {
+        return serialFib(n);
+    }
+    long long left = 0;
+    TaskScheduler::TaskGroup group(scheduler);
+    group.spawn([&]() {
+        left = parallelFib(scheduler, n - 1, cutoff);
+    });
+    long long right = parallelFib(scheduler, n - 2, cutoff);
+    group.wait();
+    return left + right;
+}
+
+// ---------- suma de un árbol ----------
+
+struct TreeNode {
+    long long value;
+    TreeNode* left;
+    TreeNode* right;
+};
+
+static TreeNode* buildTree(int depth, long long& nextValue) {
+    if (depth == 0) {
+        return nullptr;
+    }
+    TreeNode* node = new TreeNode{nextValue++, nullptr, nullptr};
+    node->left = buildTree(depth - 1, nextValue);
+    node->right = buildTree(depth - 1, nextValue);
+    return node;
+}
+
+static void freeTree(TreeNode* node) {
+    if (node != nullptr) {
+        freeTree(node->left);
+        freeTree(node->right);
+        delete node;
+    }
+}
+
+static long long serialSum(const TreeNode* node) {
+    return node == nullptr ? 0 : node->value + serialSum(node->left) + serialSum(node->right);
+}
+
+static long long parallelSum(TaskScheduler& scheduler, const TreeNode* node, int depth, int cutoff) {
+    if (depth <= cutoff) {
+        return serialSum(node);
+    }
+    long long left = 0;
+    TaskScheduler::TaskGroup group(scheduler);
+    group.spawn([&]() {
+        left = parallelSum(scheduler, node->left, depth - 1, cutoff);
+    });
+    long long right = parallelSum(scheduler, node->right, depth - 1, cutoff);
+    group.wait();
+    return node->value + left + right;
+}
+
+// ---------- medición ----------
+
+static void printRow(const std::string& name, double seconds, double serialSeconds) {
+    std::cout << std::left << std::setw(14) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(3) << seconds * 1000.0
+              << std::setw(12) << std::setprecision(2) << serialSeconds / seconds << "x\n";
+}
+
+// Ejecuta la raíz del cálculo como una tarea más del planificador
+template <typename F>
+static double timeOnScheduler(TaskScheduler& scheduler, F function) {
+    Stopwatch watch;
+    TaskScheduler::TaskGroup group(scheduler);
+    group.spawn(function);
+    group.wait();
+    return watch.elapsedSeconds();
+}
+
+int main(int argc, char** argv) {
+    int fibN = static_cast<int>(argOrDefault(argc, argv, 1, 35));
+    int treeDepth = static_cast<int>(argOrDefault(argc, argv, 2, 22));
+    std::size_t maxThreads = argOrDefault(argc, argv, 3, 2 * TaskScheduler::defaultThreads());
+    const int fibCutoff = 20;
+    const int treeCutoff = 10;
+
+    stressDeque(1000000, 3);
+
+    std::cout << "\nhilos disponibles: " << TaskScheduler::defaultThreads() << "\n";
+
+    long long expectedFib = 0;
+    Stopwatch watch;
+    expectedFib = serialFib(fibN);
+    double serialFibSeconds = watch.elapsedSeconds();
+
+    long long nextValue = 1;
+    TreeNode* root = buildTree(treeDepth, nextValue);
+    watch.reset();
+    long long expectedSum = serialSum(root);
+    double serialSumSeconds = watch.elapsedSeconds();
+    check(expectedSum == (nextValue - 1) * nextValue / 2, "serial tree sum is wrong");
+
+    std::cout << "\nfib(" << fibN << ")         tiempo (ms)  aceleracion\n";
+    printRow("serie", serialFibSeconds, serialFibSeconds);
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        TaskScheduler scheduler(threads);
+        long long result = 0;
+        double seconds = timeOnScheduler(scheduler, [&]() {
+            result = parallelFib(scheduler, fibN, fibCutoff);
+        });
+        check(result == expectedFib, "parallel fib is wrong");
+        printRow(std::to_string(threads) + " hilos", seconds, serialFibSeconds);
+    }
+
+    std::cout << "\narbol (2^" << treeDepth << " - 1 nodos) tiempo (ms)  aceleracion\n";
+    printRow("serie", serialSumSeconds, serialSumSeconds);
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        TaskScheduler scheduler(threads);
+        long long result = 0;
+        double seconds = timeOnScheduler(scheduler, [&]() {
+            result = parallelSum(scheduler, root, treeDepth, treeCutoff);
+        });
+        check(result == expectedSum, "parallel tree sum is wrong");
+        printRow(std::to_string(threads) + " hilos", seconds, serialSumSeconds);
+    }
+
+    freeTree(root);
+    return 0;
+}
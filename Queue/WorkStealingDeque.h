@@ -0,0 +1,160 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+/*
+    Deque de robo de trabajo (Chase-Lev), con los órdenes de memoria de
+    Lê, Pop, Cohen y Zappa Nardelli (2013).
+
+    Tiene un hilo propietario y cualquier número de ladrones:
+
+      - El propietario hace push y pop por el fondo (bottom_), como una pila.
+        Mientras nadie le roba, ninguna de las dos operaciones usa CAS.
+      - Los ladrones roban por la cima (top_) con un CAS, así que solo compiten
+        con el propietario cuando queda un único elemento.
+
+    El buffer es circular y crece al doble cuando se llena. Los buffers
+    anteriores no se liberan hasta destruir el deque, porque un ladrón
+    rezagado puede estar leyendo todavía de ellos.
+
+    T debe ser trivialmente copiable (normalmente un puntero a una tarea): cada
+    posición del buffer es un std::atomic<T>.
+*/
+
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque requires a trivially copyable T");
+
+public:
+    explicit WorkStealingDeque(std::size_t capacity = 1024)
+        : top_(0), bottom_(0), buffer_(new Buffer(roundUpToPowerOfTwo(capacity), nullptr)) {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    ~WorkStealingDeque() {
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        while (buffer != nullptr) {
+            Buffer* previous = buffer->previous;
+            delete buffer;
+            buffer = previous;
+        }
+    }
+
+    // Propietario: inserta por el fondo
+    void push(const T& value) {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+
+        if (bottom - top > static_cast<std::int64_t>(buffer->capacity) - 1) {
+            buffer = grow(buffer, top, bottom);
+        }
+
+        buffer->put(bottom, value);
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    // Propietario: extrae por el fondo (el último insertado)
+    std::optional<T> pop() {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Estaba vacío: restauramos bottom_
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T value = buffer->get(bottom);
+        if (top == bottom) {
+            // Último elemento: competimos con los ladrones por él
+            bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return value;
+    }
+
+    // Ladrón: extrae por la cima (el más antiguo). std::nullopt si está vacío o
+    // si otro hilo se llevó el elemento a la vez.
+    std::optional<T> steal() {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        T value = buffer->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    // Aproximado si se consulta mientras otros hilos operan
+    std::size_t size() const {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+private:
+    struct Buffer {
+        std::size_t capacity;
+        std::size_t mask;
+        std::atomic<T>* slots;
+        Buffer* previous;   // Buffer sustituido al crecer, se libera en el destructor
+
+        Buffer(std::size_t size, Buffer* previousBuffer)
+            : capacity(size), mask(size - 1), slots(new std::atomic<T>[size]), previous(previousBuffer) {}
+
+        ~Buffer() {
+            delete[] slots;
+        }
+
+        T get(std::int64_t index) const {
+            return slots[static_cast<std::size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, const T& value) {
+            slots[static_cast<std::size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<std::int64_t> top_;
+    alignas(64) std::atomic<std::int64_t> bottom_;
+    std::atomic<Buffer*> buffer_;
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    Buffer* grow(Buffer* old, std::int64_t top, std::int64_t bottom) {
+        Buffer* bigger = new Buffer(old->capacity * 2, old);
+        for (std::int64_t i = top; i < bottom; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        buffer_.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+};
@@ -1,5 +1,7 @@
 #include <iostream>
 #include "GenericQueue.h"
+#include "MinMaxQueue.h"
+#include "PriorityQueue.h"
 
 int main() {
     GenericQueue<int> q;
@@ -30,5 +32,38 @@ int main() {
     std::cout << "Cola copiada se mantiene intacta:\n";
     q2.print();
 
+    // Cola de prioridad: sale primero el menor, y un Handle permite adelantar un elemento
+    PriorityQueue<int> pq;
+    pq.push(40);
+    pq.push(15);
+    PriorityQueue<int>::Handle late = pq.push(70);
+    pq.push(25);
+
+    std::cout << "\n########## COLA DE PRIORIDAD ##########\n";
+    pq.print();
+    std::cout << "Primero: " << pq.top() << "\n";
+
+    pq.decrease_key(late, 5);
+    std::cout << "Tras decrease_key(70 -> 5), primero: " << pq.top() << "\n";
+
+    std::cout << "Extraidos en orden:";
+    while (!pq.empty()) {
+        std::cout << " " << pq.top();
+        pq.pop();
+    }
+    std::cout << "\n";
+
+    // Ventana deslizante de 3 elementos con mínimo y máximo en O(1)
+    MinMaxQueue<int> window;
+    int samples[] = {4, 8, 1, 6, 7, 3};
+    std::cout << "\n########## VENTANA DESLIZANTE (3) ##########\n";
+    for (int sample : samples) {
+        window.enqueue(sample);
+        if (window.size() > 3) {
+            window.dequeue();
+        }
+        std::cout << "Entra " << sample << " -> min " << window.min() << ", max " << window.max() << "\n";
+    }
+
     return 0;
 }
\ No newline at end of file
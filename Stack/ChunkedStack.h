@@ -0,0 +1,229 @@
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/*
+    Pila con almacenamiento contiguo por bloques (chunks).
+
+    En lugar de reservar un nodo por elemento, los elementos se guardan en
+    bloques de ChunkSize posiciones consecutivas. Solo se pide memoria al
+    sistema cuando el bloque de la cima se llena, y el último bloque liberado
+    se guarda en reserva (spare_) para reutilizarlo, de modo que push/pop
+    alrededor de la frontera de un bloque no llaman a new/delete.
+*/
+
+template <typename T, std::size_t ChunkSize = (sizeof(T) < 4096 ? 4096 / sizeof(T) : 1)>
+class ChunkedStack {
+    static_assert(ChunkSize > 0, "ChunkSize must be greater than zero");
+
+public:
+    // Constructor por defecto
+    ChunkedStack() : topChunk_(nullptr), spare_(nullptr), topCount_(0), size_(0) {}
+
+    // Constructor de copia
+    ChunkedStack(const ChunkedStack& other) : topChunk_(nullptr), spare_(nullptr), topCount_(0), size_(0) {
+        copy(other);
+    }
+
+    // Constructor de movimiento: se lleva los bloques de other sin copiar elementos
+    ChunkedStack(ChunkedStack&& other) noexcept
+        : topChunk_(other.topChunk_), spare_(nullptr), topCount_(other.topCount_), size_(other.size_) {
+        other.topChunk_ = nullptr;
+        other.topCount_ = 0;
+        other.size_ = 0;
+    }
+
+    // Sobrecarga de operador =
+    ChunkedStack& operator=(const ChunkedStack& other) {
+        if (this != &other) {
+            freeStack();
+            copy(other);
+        }
+        return *this;
+    }
+
+    // Asignación por movimiento
+    ChunkedStack& operator=(ChunkedStack&& other) noexcept {
+        if (this != &other) {
+            freeStack();
+            topChunk_ = other.topChunk_;
+            topCount_ = other.topCount_;
+            size_ = other.size_;
+            other.topChunk_ = nullptr;
+            other.topCount_ = 0;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~ChunkedStack() {
+        freeStack();
+        delete spare_;
+    }
+
+    void push(const T& item) {
+        new (reserveSlot()) T(item);
+        ++topCount_;
+        ++size_;
+    }
+
+    void push(T&& item) {
+        new (reserveSlot()) T(std::move(item));
+        ++topCount_;
+        ++size_;
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+
+        --topCount_;
+        topChunk_->slot(topCount_)->~T();
+        --size_;
+
+        // Si el bloque de la cima se queda vacío bajamos al anterior
+        if (topCount_ == 0) {
+            Chunk* aux = topChunk_;
+            topChunk_ = topChunk_->prev;
+            topCount_ = topChunk_ != nullptr ? ChunkSize : 0;
+            releaseChunk(aux);
+        }
+    }
+
+    T& top() {
+        if (empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+        return *topChunk_->slot(topCount_ - 1);
+    }
+
+    const T& top() const {
+        if (empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+        return *topChunk_->slot(topCount_ - 1);
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty Stack]\n";
+            return;
+        }
+
+        std::cout << "Cima -> ";
+        Chunk* chunk = topChunk_;
+        std::size_t count = topCount_;
+        while (chunk != nullptr) {
+            for (std::size_t i = count; i > 0; --i) {
+                std::cout << *chunk->slot(i - 1);
+                if (i > 1 || chunk->prev != nullptr) {
+                    std::cout << " | ";
+                }
+            }
+            chunk = chunk->prev;
+            count = ChunkSize;
+        }
+        std::cout << " <- Fondo\n";
+    }
+
+private:
+    // Bloque de ChunkSize elementos. La memoria se reserva sin construir los T,
+    // que se construyen con placement new en push y se destruyen en pop.
+    struct Chunk {
+        Chunk* prev;
+        alignas(T) unsigned char storage[sizeof(T) * ChunkSize];
+
+        Chunk() : prev(nullptr) {}
+
+        T* slot(std::size_t index) {
+            return std::launder(reinterpret_cast<T*>(storage) + index);
+        }
+    };
+
+    Chunk* topChunk_;
+    Chunk* spare_;           // Último bloque liberado, reservado para reutilizar
+    std::size_t topCount_;   // Elementos ocupados en el bloque de la cima
+    std::size_t size_;
+
+    // Devuelve la siguiente posición libre, abriendo un bloque nuevo si la cima está llena
+    T* reserveSlot() {
+        if (topChunk_ == nullptr || topCount_ == ChunkSize) {
+            Chunk* chunk = acquireChunk();
+            chunk->prev = topChunk_;
+            topChunk_ = chunk;
+            topCount_ = 0;
+        }
+        return topChunk_->slot(topCount_);
+    }
+
+    Chunk* acquireChunk() {
+        if (spare_ != nullptr) {
+            Chunk* chunk = spare_;
+            spare_ = nullptr;
+            return chunk;
+        }
+        return new Chunk();
+    }
+
+    void releaseChunk(Chunk* chunk) {
+        if (spare_ == nullptr) {
+            spare_ = chunk;
+        } else {
+            delete chunk;
+        }
+    }
+
+    void freeStack() {
+        std::size_t count = topCount_;
+        while (topChunk_ != nullptr) {
+            for (std::size_t i = 0; i < count; ++i) {
+                topChunk_->slot(i)->~T();
+            }
+            Chunk* aux = topChunk_;
+            topChunk_ = topChunk_->prev;
+            count = ChunkSize;
+            releaseChunk(aux);
+        }
+        topCount_ = 0;
+        size_ = 0;
+    }
+
+    void copy(const ChunkedStack& other) {
+        topChunk_ = nullptr;
+        topCount_ = 0;
+        size_ = 0;
+
+        // Copiamos bloque a bloque de la cima al fondo manteniendo las
+        // mismas posiciones, así la copia conserva el orden de la pila
+        Chunk** link = &topChunk_;
+        Chunk* current = other.topChunk_;
+        std::size_t count = other.topCount_;
+        while (current != nullptr) {
+            Chunk* chunk = acquireChunk();
+            chunk->prev = nullptr;
+            for (std::size_t i = 0; i < count; ++i) {
+                new (chunk->slot(i)) T(*current->slot(i));
+            }
+            *link = chunk;
+            link = &chunk->prev;
+            current = current->prev;
+            count = ChunkSize;
+        }
+
+        topCount_ = other.topCount_;
+        size_ = other.size_;
+    }
+};
@@ -0,0 +1,79 @@
+#include <iostream>
+#include "Benchmark.h"
+#include "ChunkedStack.h"
+#include "GenericStack.h"
+
+// BENCHMARK: GenericStack (un nodo por elemento) frente a ChunkedStack (bloques contiguos)
+//
+// Uso: ./ChunkedStackBenchmark [exponente_maximo]
+// Mide push de n elementos seguido de pop de n elementos, para n = 10^3 .. 10^exponente_maximo.
+
+template <typename Stack>
+double fillAndDrain(std::size_t n) {
+    // Repetimos los tamaños pequeños para que cada medición dure lo suficiente
+    std::size_t repetitions = n < 10000000 ? 10000000 / n : 1;
+    long long checksum = 0;
+
+    Stopwatch watch;
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        Stack stack;
+        for (std::size_t i = 0; i < n; ++i) {
+            stack.push(static_cast<long long>(i));
+        }
+        while (!stack.empty()) {
+            checksum += stack.top();
+            stack.pop();
+        }
+    }
+    double elapsed = watch.elapsedNanoseconds();
+    doNotOptimize(checksum);
+
+    return elapsed / static_cast<double>(2 * n * repetitions);
+}
+
+// Patrón de registro de deshacer: la pila oscila alrededor de un tamaño estable
+template <typename Stack>
+double undoLog(std::size_t n) {
+    Stack stack;
+    for (std::size_t i = 0; i < n; ++i) {
+        stack.push(static_cast<long long>(i));
+    }
+
+    const std::size_t operations = 10000000;
+    long long checksum = 0;
+
+    Stopwatch watch;
+    for (std::size_t i = 0; i < operations; ++i) {
+        // Tres push y tres pop por cada ciclo de 6 operaciones
+        if (i % 6 < 3) {
+            stack.push(static_cast<long long>(i));
+        } else {
+            checksum += stack.top();
+            stack.pop();
+        }
+    }
+    double elapsed = watch.elapsedNanoseconds();
+    doNotOptimize(checksum);
+
+    return elapsed / static_cast<double>(operations);
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxExponent = argOrDefault(argc, argv, 1, 8);
+
+    std::cout << "########## PUSH n + POP n ##########\n\n";
+    for (std::size_t e = 3; e <= maxExponent; ++e) {
+        std::size_t n = powerOfTen(e);
+        printResult("GenericStack", n, fillAndDrain<GenericStack<long long>>(n));
+        printResult("ChunkedStack", n, fillAndDrain<ChunkedStack<long long>>(n));
+    }
+
+    std::cout << "\n########## UNDO LOG (push/pop alternos) ##########\n\n";
+    for (std::size_t e = 3; e <= maxExponent; ++e) {
+        std::size_t n = powerOfTen(e);
+        printResult("GenericStack", n, undoLog<GenericStack<long long>>(n));
+        printResult("ChunkedStack", n, undoLog<ChunkedStack<long long>>(n));
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include "EpochReclamation.h"
+
+/*
+    Pila concurrente sin bloqueos (pila de Treiber).
+
+    La cima es un puntero atómico y push/pop se resuelven con un bucle de
+    compare_exchange sobre él. Los nodos desenlazados por pop no se borran al
+    momento sino que se retiran al EpochDomain, que los libera cuando ningún
+    hilo puede seguir leyéndolos. Eso evita tanto accesos a memoria liberada
+    como el problema ABA (la dirección de un nodo no puede reutilizarse
+    mientras otro hilo la tenga en su CAS).
+*/
+
+template <typename T>
+class EliminationStack;
+
+template <typename T>
+class ConcurrentStack {
+public:
+    // Constructor por defecto
+    ConcurrentStack() : topNode_(nullptr) {}
+
+    // Una pila compartida entre hilos no se copia
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // Destructor: ningún otro hilo puede estar usando la pila
+    ~ConcurrentStack() {
+        Node* current = topNode_.load(std::memory_order_relaxed);
+        while (current != nullptr) {
+            Node* aux = current;
+            current = current->next;
+            delete aux;
+        }
+    }
+
+    void push(const T& item) {
+        Node* node = new Node(item);
+        while (!tryPushNode(node)) {
+        }
+    }
+
+    // Extrae la cima. Devuelve std::nullopt si la pila está vacía.
+    std::optional<T> try_pop() {
+        EpochGuard guard;
+        std::optional<T> result;
+        while (!tryPopNode(result)) {
+        }
+        return result;
+    }
+
+    // Resultado instantáneo: otro hilo puede modificar la pila justo después
+    bool empty() const {
+        return topNode_.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    friend class EliminationStack<T>;
+
+    struct Node {
+        T data;
+        Node* next;
+
+        Node(const T& value, Node* nextNode = nullptr) : data(value), next(nextNode) {}
+    };
+
+    alignas(64) std::atomic<Node*> topNode_;
+
+    // Un único intento de enlazar node como nueva cima
+    bool tryPushNode(Node* node) {
+        Node* top = topNode_.load(std::memory_order_relaxed);
+        node->next = top;
+        return topNode_.compare_exchange_weak(top, node, std::memory_order_release, std::memory_order_relaxed);
+    }
+
+    // Un único intento de desenlazar la cima. Debe llamarse dentro de un EpochGuard.
+    // Devuelve true si la operación ha terminado (con valor o con la pila vacía).
+    bool tryPopNode(std::optional<T>& result) {
+        Node* top = topNode_.load(std::memory_order_acquire);
+        if (top == nullptr) {
+            return true;
+        }
+
+        // top no puede liberarse mientras dure el guard, así que leer next es seguro
+        if (!topNode_.compare_exchange_weak(top, top->next, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return false;
+        }
+
+        result.emplace(std::move(top->data));
+        EpochDomain::instance().retire(top);
+        return true;
+    }
+};
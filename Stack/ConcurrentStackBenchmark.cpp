@@ -0,0 +1,107 @@
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "ConcurrentStack.h"
+#include "EliminationStack.h"
+#include "GenericStack.h"
+
+// BENCHMARK: ConcurrentStack (Treiber + EBR) y EliminationStack frente a GenericStack protegida con un mutex
+//
+// Uso: ./ConcurrentStackBenchmark [operaciones_totales] [hilos_maximos]
+// Cada hilo alterna push y pop; se mide el rendimiento agregado para 1, 2, 4 ... hilos_maximos.
+
+// GenericStack protegida por un único mutex global (situación de partida)
+class MutexStack {
+public:
+    void push(long long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stack_.push(value);
+    }
+
+    std::optional<long long> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stack_.empty()) {
+            return std::nullopt;
+        }
+        long long value = stack_.top();
+        stack_.pop();
+        return value;
+    }
+
+private:
+    std::mutex mutex_;
+    GenericStack<long long> stack_;
+};
+
+template <typename Stack>
+double run(Stack& stack, std::size_t threads, std::size_t totalOperations) {
+    std::size_t perThread = totalOperations / threads / 2;
+    std::vector<long long> pushed(threads, 0);
+    std::vector<long long> popped(threads, 0);
+    std::vector<std::thread> workers;
+
+    Stopwatch watch;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (std::size_t i = 0; i < perThread; ++i) {
+                long long value = static_cast<long long>(t * perThread + i);
+                stack.push(value);
+                pushed[t] += value;
+                std::optional<long long> item = stack.try_pop();
+                if (item) {
+                    popped[t] += *item;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = watch.elapsedSeconds();
+
+    // Comprobación: lo que queda en la pila más lo extraído debe ser lo insertado
+    long long pushedSum = 0;
+    long long poppedSum = 0;
+    for (std::size_t t = 0; t < threads; ++t) {
+        pushedSum += pushed[t];
+        poppedSum += popped[t];
+    }
+    while (std::optional<long long> item = stack.try_pop()) {
+        poppedSum += *item;
+    }
+    if (pushedSum != poppedSum) {
+        std::cerr << "ERROR: checksum mismatch\n";
+        std::exit(1);
+    }
+
+    return static_cast<double>(2 * perThread * threads) / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    std::size_t totalOperations = argOrDefault(argc, argv, 1, 4000000);
+    std::size_t maxThreads = argOrDefault(argc, argv, 2, 64);
+
+    std::cout << "hilos   MutexStack   ConcurrentStack   EliminationStack   eliminadas   (Mops/s)\n";
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        MutexStack mutexStack;
+        double mutexRate = run(mutexStack, threads, totalOperations);
+
+        ConcurrentStack<long long> lockFreeStack;
+        double lockFreeRate = run(lockFreeStack, threads, totalOperations);
+
+        EliminationStack<long long> eliminationStack;
+        double eliminationRate = run(eliminationStack, threads, totalOperations);
+        double eliminated = eliminationStack.stats().eliminatedFraction() * 100.0;
+
+        std::cout << std::setw(5) << threads
+                  << std::setw(13) << std::fixed << std::setprecision(2) << mutexRate
+                  << std::setw(18) << lockFreeRate
+                  << std::setw(19) << eliminationRate
+                  << std::setw(12) << eliminated << "%\n";
+    }
+
+    return 0;
+}
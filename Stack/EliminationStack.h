@@ -0,0 +1,234 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "ConcurrentStack.h"
+
+/*
+    Pila concurrente con capa de eliminación (elimination-backoff stack).
+
+    Con muchos hilos, todos los CAS de ConcurrentStack compiten por la misma
+    línea de caché (topNode_). Cuando un CAS falla, en vez de reintentar sin
+    más, el hilo visita una posición aleatoria de un array de eliminación:
+
+      - Un push deja allí su nodo y espera un momento.
+      - Un pop que encuentra un nodo ofrecido se lo queda.
+
+    Un push y un pop simultáneos se anulan entre sí sin tocar la cima, lo cual
+    es correcto porque el resultado es el mismo que si se hubieran ejecutado
+    seguidos sobre la pila. El número de posiciones activas se adapta a la
+    contención: crece cuando hay colisiones y decrece cuando las ofertas
+    caducan sin pareja.
+*/
+
+template <typename T>
+class EliminationStack {
+public:
+    // Contadores agregados de operaciones
+    struct Stats {
+        std::uint64_t pushes;
+        std::uint64_t pops;
+        std::uint64_t eliminatedPushes;
+        std::uint64_t eliminatedPops;
+
+        // Fracción de operaciones que se resolvieron en el array de eliminación
+        double eliminatedFraction() const {
+            std::uint64_t total = pushes + pops;
+            return total == 0 ? 0.0 : static_cast<double>(eliminatedPushes + eliminatedPops) / static_cast<double>(total);
+        }
+    };
+
+    // capacity: número máximo de posiciones del array de eliminación
+    explicit EliminationStack(std::size_t capacity = defaultCapacity())
+        : slots_(new Slot[capacity > 0 ? capacity : 1]), capacity_(capacity > 0 ? capacity : 1), range_(1) {}
+
+    EliminationStack(const EliminationStack&) = delete;
+    EliminationStack& operator=(const EliminationStack&) = delete;
+
+    // Destructor: no puede haber ofertas pendientes porque ningún hilo está operando
+    ~EliminationStack() {
+        delete[] slots_;
+    }
+
+    void push(const T& item) {
+        Node* node = new Node(item);
+        Counters& counters = localCounters();
+        counters.pushes.fetch_add(1, std::memory_order_relaxed);
+
+        while (true) {
+            if (stack_.tryPushNode(node)) {
+                return;
+            }
+            if (tryEliminatePush(node)) {
+                counters.eliminatedPushes.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    // Extrae la cima. Devuelve std::nullopt si la pila está vacía.
+    std::optional<T> try_pop() {
+        EpochGuard guard;
+        Counters& counters = localCounters();
+        counters.pops.fetch_add(1, std::memory_order_relaxed);
+
+        std::optional<T> result;
+        while (true) {
+            if (stack_.tryPopNode(result)) {
+                return result;
+            }
+            if (tryEliminatePop(result)) {
+                counters.eliminatedPops.fetch_add(1, std::memory_order_relaxed);
+                return result;
+            }
+        }
+    }
+
+    bool empty() const {
+        return stack_.empty();
+    }
+
+    // Suma de los contadores de todas las franjas
+    Stats stats() const {
+        Stats total{0, 0, 0, 0};
+        for (std::size_t i = 0; i < kCounterStripes; ++i) {
+            total.pushes += counters_[i].pushes.load(std::memory_order_relaxed);
+            total.pops += counters_[i].pops.load(std::memory_order_relaxed);
+            total.eliminatedPushes += counters_[i].eliminatedPushes.load(std::memory_order_relaxed);
+            total.eliminatedPops += counters_[i].eliminatedPops.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    // Posiciones del array que se están usando ahora mismo
+    std::size_t activeRange() const {
+        return range_.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Node = typename ConcurrentStack<T>::Node;
+
+    static constexpr std::size_t kSpins = 16;
+    static constexpr std::size_t kCounterStripes = 16;
+
+    // Posición del array: nullptr (libre), un nodo ofrecido por un push o la marca taken()
+    struct alignas(64) Slot {
+        std::atomic<Node*> offer{nullptr};
+    };
+
+    // Los contadores se reparten en franjas para no crear otro punto caliente
+    struct alignas(64) Counters {
+        std::atomic<std::uint64_t> pushes{0};
+        std::atomic<std::uint64_t> pops{0};
+        std::atomic<std::uint64_t> eliminatedPushes{0};
+        std::atomic<std::uint64_t> eliminatedPops{0};
+    };
+
+    ConcurrentStack<T> stack_;
+    Slot* slots_;
+    std::size_t capacity_;
+    alignas(64) std::atomic<std::size_t> range_;
+    Counters counters_[kCounterStripes];
+
+    static std::size_t defaultCapacity() {
+        std::size_t cores = std::thread::hardware_concurrency();
+        return cores > 1 ? cores / 2 : 1;
+    }
+
+    // Marca que deja un pop en la posición al quedarse con el nodo ofrecido
+    static Node* taken() {
+        return reinterpret_cast<Node*>(std::uintptr_t{1});
+    }
+
+    // Generador xorshift propio de cada hilo
+    static std::size_t nextRandom() {
+        thread_local std::uint64_t state =
+            std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<std::size_t>(state);
+    }
+
+    Counters& localCounters() {
+        thread_local std::size_t stripe = nextRandom() % kCounterStripes;
+        return counters_[stripe];
+    }
+
+    Slot& randomSlot() {
+        return slots_[nextRandom() % range_.load(std::memory_order_relaxed)];
+    }
+
+    // Hay colisiones: repartimos a los hilos en más posiciones
+    void grow() {
+        std::size_t range = range_.load(std::memory_order_relaxed);
+        if (range < capacity_) {
+            range_.compare_exchange_weak(range, range + 1, std::memory_order_relaxed);
+        }
+    }
+
+    // Las ofertas caducan sin pareja: concentramos a los hilos en menos posiciones
+    void shrink() {
+        std::size_t range = range_.load(std::memory_order_relaxed);
+        if (range > 1) {
+            range_.compare_exchange_weak(range, range - 1, std::memory_order_relaxed);
+        }
+    }
+
+    // El push ofrece su nodo. Devuelve true si un pop se lo ha llevado.
+    bool tryEliminatePush(Node* node) {
+        Slot& slot = randomSlot();
+
+        Node* expected = nullptr;
+        if (!slot.offer.compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+            grow();
+            return false;
+        }
+
+        for (std::size_t i = 0; i < kSpins; ++i) {
+            if (slot.offer.load(std::memory_order_acquire) == taken()) {
+                slot.offer.store(nullptr, std::memory_order_release);
+                return true;
+            }
+            std::this_thread::yield();
+        }
+
+        // Retiramos la oferta; si el CAS falla es porque un pop la tomó justo ahora
+        expected = node;
+        if (slot.offer.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+            shrink();
+            return false;
+        }
+
+        slot.offer.store(nullptr, std::memory_order_release);
+        return true;
+    }
+
+    // El pop busca un nodo ofrecido. Devuelve true si ha conseguido uno.
+    bool tryEliminatePop(std::optional<T>& result) {
+        Slot& slot = randomSlot();
+
+        for (std::size_t i = 0; i < kSpins; ++i) {
+            Node* offered = slot.offer.load(std::memory_order_acquire);
+            if (offered != nullptr && offered != taken()) {
+                if (slot.offer.compare_exchange_strong(offered, taken(), std::memory_order_acquire, std::memory_order_relaxed)) {
+                    // El push ya no vuelve a tocar el nodo: es nuestro y se puede borrar directamente
+                    result.emplace(std::move(offered->data));
+                    delete offered;
+                    return true;
+                }
+                grow();
+                return false;
+            }
+            std::this_thread::yield();
+        }
+
+        shrink();
+        return false;
+    }
+};
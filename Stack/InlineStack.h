@@ -0,0 +1,185 @@
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ChunkedStack.h"
+
+/*
+    Pila con almacenamiento inline (small buffer optimization).
+
+    Los primeros N elementos se guardan dentro del propio objeto, así una pila
+    local que nunca supera N elementos no toca el heap en ningún momento. A
+    partir del elemento N + 1 los elementos desbordan a una ChunkedStack, que
+    los guarda en bloques contiguos del heap.
+
+        inline_: [ e0 | e1 | ... | eN-1 ]   ← fondo de la pila
+        overflow_: bloques con eN, eN+1, ...  ← cima de la pila
+*/
+
+template <typename T, std::size_t N = 16>
+class InlineStack {
+    static_assert(N > 0, "InlineStack needs at least one inline slot");
+
+public:
+    // Constructor por defecto
+    InlineStack() : inlineCount_(0) {}
+
+    // Constructor de copia
+    InlineStack(const InlineStack& other) : inlineCount_(0), overflow_(other.overflow_) {
+        for (std::size_t i = 0; i < other.inlineCount_; ++i) {
+            new (slot(i)) T(*other.slot(i));
+            ++inlineCount_;
+        }
+    }
+
+    // Constructor de movimiento. Los elementos inline se mueven uno a uno;
+    // los bloques desbordados cambian de dueño sin copiarse. Solo es noexcept
+    // si mover un T no puede lanzar. Delega en el constructor por defecto para
+    // que, si un movimiento lanza, el destructor libere lo ya movido.
+    InlineStack(InlineStack&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : InlineStack() {
+        overflow_ = std::move(other.overflow_);
+        moveInline(other);
+    }
+
+    // Sobrecarga de operador =
+    InlineStack& operator=(const InlineStack& other) {
+        if (this != &other) {
+            clearInline();
+            overflow_ = other.overflow_;
+            for (std::size_t i = 0; i < other.inlineCount_; ++i) {
+                new (slot(i)) T(*other.slot(i));
+                ++inlineCount_;
+            }
+        }
+        return *this;
+    }
+
+    // Asignación por movimiento
+    InlineStack& operator=(InlineStack&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clearInline();
+            overflow_ = std::move(other.overflow_);
+            moveInline(other);
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~InlineStack() {
+        clearInline();
+    }
+
+    void push(const T& item) {
+        if (inlineCount_ < N) {
+            new (slot(inlineCount_)) T(item);
+            ++inlineCount_;
+        } else {
+            overflow_.push(item);
+        }
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+
+        // La cima está en el desbordamiento mientras este tenga elementos
+        if (!overflow_.empty()) {
+            overflow_.pop();
+        } else {
+            --inlineCount_;
+            slot(inlineCount_)->~T();
+        }
+    }
+
+    T& top() {
+        if (empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+
+        if (!overflow_.empty()) {
+            return overflow_.top();
+        }
+        return *slot(inlineCount_ - 1);
+    }
+
+    bool empty() const {
+        return inlineCount_ == 0;
+    }
+
+    std::size_t size() const {
+        return inlineCount_ + overflow_.size();
+    }
+
+    // true si algún elemento vive fuera del objeto
+    bool spilled() const {
+        return !overflow_.empty();
+    }
+
+    // Capacidad inline
+    static constexpr std::size_t inlineCapacity() {
+        return N;
+    }
+
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty Stack]\n";
+            return;
+        }
+
+        // Primero la parte desbordada (más cercana a la cima) y luego la inline
+        if (!overflow_.empty()) {
+            ChunkedStack<T> copyOverflow(overflow_);
+            std::cout << "Cima -> ";
+            while (!copyOverflow.empty()) {
+                std::cout << copyOverflow.top() << " | ";
+                copyOverflow.pop();
+            }
+        } else {
+            std::cout << "Cima -> ";
+        }
+
+        for (std::size_t i = inlineCount_; i > 0; --i) {
+            std::cout << *slot(i - 1);
+            if (i > 1) {
+                std::cout << " | ";
+            }
+        }
+        std::cout << " <- Fondo\n";
+    }
+
+private:
+    alignas(T) unsigned char storage_[sizeof(T) * N];
+    std::size_t inlineCount_;
+    ChunkedStack<T> overflow_;
+
+    T* slot(std::size_t index) {
+        return std::launder(reinterpret_cast<T*>(storage_) + index);
+    }
+
+    const T* slot(std::size_t index) const {
+        return std::launder(reinterpret_cast<const T*>(storage_) + index);
+    }
+
+    void clearInline() {
+        for (std::size_t i = 0; i < inlineCount_; ++i) {
+            slot(i)->~T();
+        }
+        inlineCount_ = 0;
+    }
+
+    // Mueve los elementos inline de other y lo deja vacío. Los originales se
+    // destruyen al final: si mover uno lanza, las dos pilas siguen contando
+    // bien sus elementos.
+    void moveInline(InlineStack& other) {
+        for (std::size_t i = 0; i < other.inlineCount_; ++i) {
+            new (slot(i)) T(std::move(*other.slot(i)));
+            ++inlineCount_;
+        }
+        other.clearInline();
+    }
+};
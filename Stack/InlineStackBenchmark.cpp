@@ -0,0 +1,103 @@
+#include <iostream>
+#include <string>
+#include <utility>
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+#include "ChunkedStack.h"
+#include "GenericStack.h"
+#include "InlineStack.h"
+
+// BENCHMARK: pilas locales de vida corta (GenericStack, ChunkedStack e InlineStack<T, 16>)
+//
+// Uso: ./InlineStackBenchmark [repeticiones]
+// Cada repetición crea una pila, inserta "profundidad" elementos, los extrae y la destruye.
+// Además de medir el tiempo se cuentan las reservas de memoria dinámica.
+
+// Comprobaciones de reservas y de copia/movimiento entre los estados inline y desbordado
+static void checkInlineStack() {
+    std::size_t before = allocationCount;
+    {
+        InlineStack<int, 16> stack;
+        for (int i = 0; i < 16; ++i) {
+            stack.push(i);
+        }
+        InlineStack<int, 16> copyStack(stack);
+        InlineStack<int, 16> movedStack(std::move(copyStack));
+        check(movedStack.size() == 16 && movedStack.top() == 15, "move of inline stack");
+        check(copyStack.empty(), "moved-from inline stack must be empty");
+        while (!stack.empty()) {
+            stack.pop();
+        }
+    }
+    check(allocationCount == before, "InlineStack allocated with 16 or fewer elements");
+
+    // Con 40 elementos la pila desborda: 16 inline + 24 en el heap
+    InlineStack<std::string, 16> spilled;
+    for (int i = 0; i < 40; ++i) {
+        spilled.push(std::to_string(i));
+    }
+    check(spilled.spilled() && spilled.size() == 40, "stack should spill past N");
+
+    InlineStack<std::string, 16> copySpilled(spilled);
+    check(copySpilled.size() == 40 && copySpilled.top() == "39", "copy of spilled stack");
+
+    before = allocationCount;
+    InlineStack<std::string, 16> movedSpilled(std::move(copySpilled));
+    check(allocationCount == before, "moving a spilled stack must not allocate chunks");
+    check(movedSpilled.size() == 40 && copySpilled.empty(), "move of spilled stack");
+
+    // Asignar una pila inline sobre una desbordada y viceversa
+    InlineStack<std::string, 16> small;
+    small.push("a");
+    movedSpilled = small;
+    check(movedSpilled.size() == 1 && !movedSpilled.spilled() && movedSpilled.top() == "a", "assign inline over spilled");
+    small = std::move(spilled);
+    check(small.size() == 40 && small.spilled() && spilled.empty(), "move-assign spilled over inline");
+
+    for (int i = 39; i >= 0; --i) {
+        check(small.top() == std::to_string(i), "LIFO order across inline/spilled boundary");
+        small.pop();
+    }
+    check(small.empty(), "stack should be empty");
+}
+
+template <typename Stack>
+void run(const std::string& name, std::size_t depth, std::size_t repetitions) {
+    long long checksum = 0;
+    std::size_t before = allocationCount;
+
+    Stopwatch watch;
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        Stack stack;
+        for (std::size_t i = 0; i < depth; ++i) {
+            stack.push(static_cast<int>(i + r));
+        }
+        while (!stack.empty()) {
+            checksum += stack.top();
+            stack.pop();
+        }
+    }
+    double elapsed = watch.elapsedNanoseconds();
+    doNotOptimize(checksum);
+
+    double allocationsPerStack = static_cast<double>(allocationCount - before) / static_cast<double>(repetitions);
+    printResult(name, depth, elapsed / static_cast<double>(2 * depth * repetitions));
+    std::cout << std::setw(40) << allocationsPerStack << " reservas por pila\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t repetitions = argOrDefault(argc, argv, 1, 1000000);
+
+    checkInlineStack();
+    std::cout << "Comprobaciones de InlineStack: OK\n\n";
+
+    const std::size_t depths[] = {4, 16, 64};
+    for (std::size_t depth : depths) {
+        run<GenericStack<int>>("GenericStack", depth, repetitions);
+        run<ChunkedStack<int>>("ChunkedStack", depth, repetitions);
+        run<InlineStack<int, 16>>("InlineStack<int, 16>", depth, repetitions);
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "ChunkedStack.h"
+
+/*
+    Pila que responde min() y max() en O(1).
+
+    Cada posición guarda, junto al valor, el mínimo y el máximo de todos los
+    elementos que hay desde el fondo hasta ella. Al apilar basta con
+    compararlos con los de la cima anterior, y al desapilar la nueva cima ya
+    tiene los suyos calculados.
+
+    Compare define el orden ("a va antes que b"); con std::less, min() es el
+    menor y max() el mayor. Los elementos se guardan en una ChunkedStack.
+*/
+
+template <typename T, typename Compare = std::less<T>>
+class MinMaxStack {
+public:
+    explicit MinMaxStack(const Compare& compare = Compare()) : compare_(compare) {}
+
+    void push(const T& item) {
+        if (entries_.empty()) {
+            entries_.push(Entry{item, item, item});
+            return;
+        }
+
+        const Entry& current = entries_.top();
+        const T& min = compare_(item, current.min) ? item : current.min;
+        const T& max = compare_(current.max, item) ? item : current.max;
+        entries_.push(Entry{item, min, max});
+    }
+
+    void pop() {
+        entries_.pop();
+    }
+
+    const T& top() const {
+        return entries_.top().value;
+    }
+
+    const T& min() const {
+        return entries_.top().min;
+    }
+
+    const T& max() const {
+        return entries_.top().max;
+    }
+
+    bool empty() const {
+        return entries_.empty();
+    }
+
+    std::size_t size() const {
+        return entries_.size();
+    }
+
+    void print() const {
+        if (empty()) {
+            std::cout << "[Empty Stack]\n";
+            return;
+        }
+        std::cout << "Cima -> " << top() << " (min " << min() << ", max " << max() << "), "
+                  << size() << " elementos\n";
+    }
+
+private:
+    struct Entry {
+        T value;
+        T min;   // Mínimo desde el fondo hasta esta posición
+        T max;   // Máximo desde el fondo hasta esta posición
+    };
+
+    ChunkedStack<Entry> entries_;
+    Compare compare_;
+};
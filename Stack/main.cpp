@@ -1,5 +1,8 @@
 #include <iostream>
+#include "ChunkedStack.h"
 #include "GenericStack.h"
+#include "InlineStack.h"
+#include "MinMaxStack.h"
 
 // EJEMPLO DE USO DE PILA
 
@@ -33,5 +36,44 @@ int main() {
     std::cout << "Nueva cima original tras pop: " << stack.top() << std::endl;
     std::cout << "Cima copia (independiente): " << stack2.top() << std::endl;
 
+    // Misma interfaz con almacenamiento contiguo por bloques
+    ChunkedStack<int> chunked;
+    chunked.push(1);
+    chunked.push(10);
+    chunked.push(5);
+    chunked.push(67);
+
+    std::cout << "\n########## PILA POR BLOQUES ##########\n\n";
+    chunked.print();
+
+    ChunkedStack<int> chunked2(chunked);
+    chunked.pop();
+    std::cout << "Cima tras pop: " << chunked.top() << std::endl;
+    std::cout << "Cima copia (independiente): " << chunked2.top() << std::endl;
+
+    // Los 4 primeros elementos se guardan dentro del objeto; el resto desborda al heap
+    InlineStack<int, 4> small;
+    for (int i = 1; i <= 6; ++i) {
+        small.push(i);
+    }
+
+    std::cout << "\n########## PILA INLINE (N = 4) ##########\n\n";
+    small.print();
+    std::cout << "Desbordada: " << (small.spilled() ? "si" : "no") << std::endl;
+    small.pop();
+    small.pop();
+    std::cout << "Tras dos pop, desbordada: " << (small.spilled() ? "si" : "no") << std::endl;
+
+    // Cada posición recuerda el mínimo y el máximo hasta ella: min() y max() en O(1)
+    MinMaxStack<int> minMax;
+    minMax.push(5);
+    minMax.push(2);
+    minMax.push(9);
+
+    std::cout << "\n########## PILA CON MINIMO Y MAXIMO ##########\n\n";
+    minMax.print();
+    minMax.pop();
+    std::cout << "Tras pop: min " << minMax.min() << ", max " << minMax.max() << std::endl;
+
     return 0;
 }
\ No newline at end of file